@@ -202,6 +202,9 @@ extern int fex_set_log __P((FILE *));
 extern int fex_get_log_depth __P((void));
 extern int fex_set_log_depth __P((int));
 extern void fex_log_entry __P((const char *));
+extern int fex_get_log_async __P((void));
+extern int fex_set_log_async __P((int));
+extern void fex_log_flush __P((void));
 
 #define	__fex_handler_t	fex_handler_t
 
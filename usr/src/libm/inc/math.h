@@ -300,6 +300,13 @@ extern void sincosl __P((long double, long double *, long double *));
 #pragma does_not_read_global_data(sincos, sincosf, sincosl)
 #endif
 
+/*
+ * exp, log and pow correctly rounded to nearest
+ */
+extern double cr_exp __P((double));
+extern double cr_log __P((double));
+extern double cr_pow __P((double, double));
+
 /* BEGIN adopted by C99 */
 /*
  * Functions callable from C, intended to support IEEE arithmetic.
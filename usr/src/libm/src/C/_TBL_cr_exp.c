@@ -0,0 +1,167 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#include "libm_protos.h"
+
+/*
+ * Table for cr_exp and cr_pow
+ *
+ * _TBL_cr_exp[2*j] + _TBL_cr_exp[2*j+1] = 2^(j/128) for j = 0 to 127,
+ * where _TBL_cr_exp[2*j] is 2^(j/128) rounded to a multiple of 2^-40
+ * (41 significant bits, so that its product with a 12-bit number is
+ * exact) and _TBL_cr_exp[2*j+1] is the rest rounded to double, so
+ * that the sum has a relative error less than 2^-93.
+ */
+const double _TBL_cr_exp[] = {
+ 1.00000000000000000e+00,  0.00000000000000000e+00,
+ 1.00542990111262043e+00,  1.82393612508805261e-13,
+ 1.01088928605167894e+00,  2.15230918991246686e-14,
+ 1.01637831491098041e+00, -2.73692081065108461e-14,
+ 1.02189714865380665e+00,  3.10025360725633459e-13,
+ 1.02744594911837339e+00,  3.90304854716458580e-13,
+ 1.03302487902146822e+00, -2.39800572480159788e-13,
+ 1.03863410196117911e+00,  1.99678062565491667e-13,
+ 1.04427378242780833e+00, -3.94487744054725258e-13,
+ 1.04994408580023446e+00,  4.52804878820620109e-13,
+ 1.05564517836046434e+00,  9.28164041844018593e-14,
+ 1.06137722728908557e+00,  1.76513487378314523e-13,
+ 1.06714040067708993e+00, -2.66310479844780969e-13,
+ 1.07293486752587341e+00,  1.02136678596671038e-13,
+ 1.07876079775724065e+00, -1.20858831683577602e-13,
+ 1.08461836221340491e+00, -9.56695631942303351e-14,
+ 1.09050773266517353e+00,  8.41244374457887449e-14,
+ 1.09642908181649545e+00, -1.18631018364811213e-13,
+ 1.10238258330809913e+00, -2.58185215159095718e-13,
+ 1.10836841172385903e+00, -1.80388087337577234e-13,
+ 1.11438674259625259e+00, -3.60052246403832339e-13,
+ 1.12043775240999821e+00, -3.91526649341895714e-13,
+ 1.12652161860842170e+00, -1.79804471421687412e-13,
+ 1.13263851959891326e+00, -1.94034611142809993e-13,
+ 1.13878863475656544e+00,  1.26210463724178045e-13,
+ 1.14497214443144912e+00,  3.55095736174046780e-13,
+ 1.15118922995316098e+00, -1.78269310652611492e-13,
+ 1.15744007363355195e+00,  1.99082771905441731e-13,
+ 1.16372485877764120e+00, -6.36885095651147482e-14,
+ 1.17004376968361612e+00, -3.65931356660653383e-13,
+ 1.17639699165010825e+00,  1.73028289269141564e-13,
+ 1.18278471098437876e+00, -3.77321530829545344e-14,
+ 1.18920711500231846e+00,  4.02606688881396413e-13,
+ 1.19566439204027120e+00, -4.43820999208432777e-13,
+ 1.20215673145230539e+00,  3.97748337235723616e-13,
+ 1.20868432362658496e+00, -3.37813633332775961e-15,
+ 1.21524735998082178e+00, -3.52906003532801580e-13,
+ 1.22184603297318972e+00, -4.32204911396224937e-13,
+ 1.22848053610687202e+00, -2.01738926063830716e-15,
+ 1.23515106393733731e+00, -4.04006688802075048e-13,
+ 1.24185781207324908e+00,  2.34969772286601495e-13,
+ 1.24860097718919860e+00,  6.13463082791065683e-15,
+ 1.25538075702479546e+00, -1.04367675704586008e-13,
+ 1.26219735039467196e+00, -4.21249460191659140e-13,
+ 1.26905095719212113e+00, -3.87909256871898340e-13,
+ 1.27594177839637268e+00,  1.94170349309198653e-14,
+ 1.28287001607895945e+00, -1.81171261669643114e-13,
+ 1.28983587340644590e+00,  2.19913651451089976e-13,
+ 1.29683955465134204e+00, -3.32375391069976982e-13,
+ 1.30388126519210346e+00, -1.67557199962415960e-13,
+ 1.31096121152495471e+00, -1.90364041782107026e-13,
+ 1.31807960126570833e+00,  3.55660877531628645e-13,
+ 1.32523664315976930e+00, -2.80062075326543324e-14,
+ 1.33243254708304448e+00,  1.16966490929182341e-13,
+ 1.33966752405285661e+00,  4.46398928725261235e-13,
+ 1.34694178623249172e+00,  4.54113457722701575e-13,
+ 1.35425554693665617e+00,  2.36554513728956349e-13,
+ 1.36160902063784306e+00,  3.81696209653790070e-13,
+ 1.36900242297451769e+00,  7.29265683946014627e-14,
+ 1.37643597075475554e+00, -2.25444259888265501e-13,
+ 1.38390988196351827e+00,  3.13681321642481305e-13,
+ 1.39142437577174860e+00,  1.77586622191372146e-13,
+ 1.39897967253818933e+00,  1.21806345971751663e-13,
+ 1.40657599381938780e+00, -3.72361767544465392e-13,
+ 1.41421356237333384e+00, -2.38794623227543172e-13,
+ 1.42189260216946423e+00, -2.98666071453082991e-13,
+ 1.42961333839230065e+00, -3.30636448375860668e-13,
+ 1.43737599744872568e+00,  2.56641522953171540e-13,
+ 1.44518080697707774e+00, -3.11164822708543252e-14,
+ 1.45302799584897002e+00,  8.25427935460176894e-14,
+ 1.46091779418020451e+00,  4.42478893843726638e-13,
+ 1.46885043333713838e+00, -1.56456787644581730e-13,
+ 1.47682614593941253e+00,  8.67846005801183154e-14,
+ 1.48484516587268445e+00,  6.80534499747036493e-14,
+ 1.49290772829135676e+00, -9.19122735188086724e-14,
+ 1.50101406962676265e+00, -3.37127847948955405e-13,
+ 1.50916442759353231e+00, -1.09569635760815868e-13,
+ 1.51735904119777842e+00,  4.36274561682966109e-13,
+ 1.52559815074437211e+00,  1.66201159671725020e-13,
+ 1.53388199784058088e+00,  3.75122089986822247e-13,
+ 1.54221082540789212e+00,  4.87072668266788354e-14,
+ 1.55058487768474151e+00,  2.58445319426145731e-13,
+ 1.55900440023742703e+00,  4.09932152762141384e-13,
+ 1.56746963996556588e+00, -1.29821077033403126e-14,
+ 1.57598084510755143e+00,  3.35055171915400965e-13,
+ 1.58453826525237673e+00,  1.16998169078456901e-13,
+ 1.59314215134236292e+00, -9.60242133930366390e-14,
+ 1.60179275568225421e+00,  4.39143679367176669e-13,
+ 1.61049033194922231e+00,  3.19991303017743041e-14,
+ 1.61923513519468543e+00,  1.78322759088954360e-13,
+ 1.62802742185704119e+00,  3.06576469850621182e-13,
+ 1.63686744976712362e+00, -1.59128998480534245e-13,
+ 1.64575547815366008e+00,  3.04765985762931244e-13,
+ 1.65469176765600423e+00,  1.90166614758858748e-13,
+ 1.66367658032686450e+00, -1.28060827114775925e-13,
+ 1.67271017964139901e+00,  1.97564931223631864e-13,
+ 1.68179283050722006e+00,  2.09025963334660287e-13,
+ 1.69092479926894157e+00,  3.63612366152457347e-13,
+ 1.70010635371818353e+00,  3.39942266420852519e-13,
+ 1.70933776310084795e+00, -3.85124032734570624e-13,
+ 1.71861929812257586e+00, -9.79401845761214409e-14,
+ 1.72795123096148018e+00,  3.57384304110688338e-13,
+ 1.73733383527360274e+00,  1.03504429788057521e-13,
+ 1.74676738619928074e+00, -1.11795959182125822e-13,
+ 1.75625216037315113e+00,  1.48355397496875414e-13,
+ 1.76578843593324564e+00,  2.71840549510346521e-14,
+ 1.77537649252644769e+00,  7.35610615481509266e-14,
+ 1.78501661131849687e+00,  4.38109335917207780e-13,
+ 1.79470907500308385e+00,  2.33329109755561980e-14,
+ 1.80445416780639789e+00,  2.25989635589593934e-13,
+ 1.81425217550076923e+00, -3.70470096330341442e-13,
+ 1.82410338540739758e+00, -3.44270733912421281e-13,
+ 1.83400808640908508e+00,  2.57382528180353756e-13,
+ 1.84396656895842170e+00,  2.04221639110759303e-13,
+ 1.85397912508324225e+00,  1.43316389051552479e-13,
+ 1.86404604839754029e+00,  2.48755366642841294e-13,
+ 1.87416763411056309e+00, -2.63184084470292156e-13,
+ 1.88434417903226858e+00,  6.58649817314789632e-14,
+ 1.89457598158696783e+00, -2.18641201389814788e-15,
+ 1.90486334181787242e+00, -1.98220493622905769e-13,
+ 1.91520656139709899e+00,  4.82995244130948673e-14,
+ 1.92560594363567361e+00,  4.51317532174891704e-13,
+ 1.93606179349262675e+00, -3.32297449713165126e-13,
+ 1.94657441757954075e+00, -3.07463667597673017e-13,
+ 1.95714412417510175e+00,  2.98517556697152440e-13,
+ 1.96777122323328513e+00, -1.09349094903230712e-13,
+ 1.97845602638790297e+00,  4.80020234169160421e-14,
+ 1.98919884696715599e+00,  1.10364373780378932e-13,
+};
@@ -0,0 +1,296 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#include "libm_protos.h"
+
+/*
+ * Table for cr_log and cr_pow
+ *
+ * For i = 0 to 255, let c[i] = 1 + (i + 1/2)/256.  Then
+ * _TBL_cr_log[3*i] is 1/c[i] rounded to a multiple of 2^-9, and
+ * _TBL_cr_log[3*i+1] and _TBL_cr_log[3*i+2] are the high and low
+ * parts of -log(_TBL_cr_log[3*i]), with an error less than 2^-95.
+ * The high part is a multiple of 2^-42, like the high part of ln2
+ * in cr_log.c and cr_pow.c, so that n*ln2_hi plus it is exact.
+ */
+const double _TBL_cr_log[] = {
+ 9.98046875000000000e-01,  1.95503483587344817e-03, -7.00976158880064010e-14,
+ 9.94140625000000000e-01,  5.87660848896121024e-03,  2.38316786839706227e-14,
+ 9.90234375000000000e-01,  9.81362144830200123e-03,  2.26200261755812690e-14,
+ 9.86328125000000000e-01,  1.37661957642194466e-02, -7.14873032749649214e-14,
+ 9.82421875000000000e-01,  1.77344549397275841e-02,  4.09942034033015450e-14,
+ 9.78515625000000000e-01,  2.17185239546324738e-02,  1.05123398085960240e-14,
+ 9.74609375000000000e-01,  2.57185292880421912e-02, -5.30717131965629478e-14,
+ 9.70703125000000000e-01,  2.97345989429231849e-02, -4.41266296228630868e-14,
+ 9.68750000000000000e-01,  3.17486983146864077e-02, -1.06106527352240874e-13,
+ 9.64843750000000000e-01,  3.57891078515422123e-02,  4.30669734768781448e-14,
+ 9.60937500000000000e-01,  3.98459085472495644e-02, -4.98937767167732853e-14,
+ 9.57031250000000000e-01,  4.39192339347300731e-02,  1.05417438543428621e-13,
+ 9.53125000000000000e-01,  4.80092191862695472e-02,  9.10605437913092918e-14,
+ 9.49218750000000000e-01,  5.21160011389838473e-02,  3.01710210618869442e-14,
+ 9.47265625000000000e-01,  5.41757341020456806e-02, -2.10925914813364838e-14,
+ 9.43359375000000000e-01,  5.83079713869665284e-02, -3.14309232381671126e-14,
+ 9.39453125000000000e-01,  6.24573549337128497e-02,  3.37545907730384208e-14,
+ 9.35546875000000000e-01,  6.66240276286771405e-02, -8.45908172817447966e-14,
+ 9.31640625000000000e-01,  7.08081341510933271e-02,  7.32407290540002681e-14,
+ 9.29687500000000000e-01,  7.29067708080037846e-02,  8.39959427404433684e-14,
+ 9.25781250000000000e-01,  7.71173033444938483e-02, -6.25585020017640496e-14,
+ 9.21875000000000000e-01,  8.13456394539571193e-02, -4.71337077830098389e-15,
+ 9.19921875000000000e-01,  8.34665310230775503e-02,  1.24855912294799348e-14,
+ 9.16015625000000000e-01,  8.77218565931343619e-02,  9.40580783438362567e-14,
+ 9.12109375000000000e-01,  9.19953673706004338e-02,  1.00394382268193199e-14,
+ 9.10156250000000000e-01,  9.41389909139616066e-02, -9.96965302307970608e-14,
+ 9.06250000000000000e-01,  9.84400728132186487e-02,  3.38712410292414163e-14,
+ 9.02343750000000000e-01,  1.02759733957782373e-01, -1.34384062288309544e-14,
+ 9.00390625000000000e-01,  1.04926582042935479e-01, -7.62125843192494836e-14,
+ 8.96484375000000000e-01,  1.09274414978926870e-01,  3.57599299772675377e-14,
+ 8.92578125000000000e-01,  1.13641234145234193e-01,  6.88921419200847455e-14,
+ 8.90625000000000000e-01,  1.15831815525098136e-01,  2.35688221820387556e-14,
+ 8.86718750000000000e-01,  1.20227426998098963e-01,  6.08373841997257353e-14,
+ 8.84765625000000000e-01,  1.22432499556452967e-01,  2.07973371022771765e-14,
+ 8.80859375000000000e-01,  1.26857285536743802e-01,  8.56344586725650386e-14,
+ 8.78906250000000000e-01,  1.29077042275184795e-01, -4.24512160896199949e-14,
+ 8.75000000000000000e-01,  1.33531392624490763e-01,  3.18597363490783339e-14,
+ 8.73046875000000000e-01,  1.35766030425884310e-01,  5.46425605545977236e-14,
+ 8.69140625000000000e-01,  1.40250342873287082e-01, -1.95097655152831655e-14,
+ 8.67187500000000000e-01,  1.42500062607268774e-01,  1.42564394781990348e-14,
+ 8.63281250000000000e-01,  1.47014742961800948e-01,  8.71078379612247809e-15,
+ 8.61328125000000000e-01,  1.49279749592551525e-01,  1.10266770174141115e-13,
+ 8.57421875000000000e-01,  1.53825211964431219e-01, -9.47840410519611816e-14,
+ 8.55468750000000000e-01,  1.56105714662999162e-01,  6.24927493160653742e-14,
+ 8.51562500000000000e-01,  1.60682381690548937e-01, -7.54710602824480666e-14,
+ 8.49609375000000000e-01,  1.62978593950811046e-01,  1.26456329844314173e-14,
+ 8.45703125000000000e-01,  1.67586897036926530e-01,  9.14081988949141234e-14,
+ 8.43750000000000000e-01,  1.69899036795413849e-01, -1.63762764140975031e-14,
+ 8.39843750000000000e-01,  1.74539416351990440e-01, -9.07623155669979559e-14,
+ 8.37890625000000000e-01,  1.76867706111579537e-01, -8.87235651731518463e-14,
+ 8.35937500000000000e-01,  1.79201429457634731e-01,  7.62615367742933921e-14,
+ 8.32031250000000000e-01,  1.83885278770048899e-01,  8.84637355812086947e-14,
+ 8.30078125000000000e-01,  1.86235456115127818e-01, -3.68623071742394014e-14,
+ 8.26171875000000000e-01,  1.90952445993161746e-01,  6.80694249676273351e-14,
+ 8.24218750000000000e-01,  1.93319311003506300e-01, -1.03204436886988491e-14,
+ 8.22265625000000000e-01,  1.95691791357148759e-01, -2.23916678550548511e-14,
+ 8.18359375000000000e-01,  2.00453705117297432e-01,  7.26221516773877611e-14,
+ 8.16406250000000000e-01,  2.02843192514819748e-01, -6.82766178718549767e-14,
+ 8.14453125000000000e-01,  2.05238403240628031e-01,  7.83049721922719644e-14,
+ 8.10546875000000000e-01,  2.10046104808725431e-01,  8.40554666334703452e-14,
+ 8.08593750000000000e-01,  2.12458651214092242e-01,  1.01159441965904669e-13,
+ 8.06640625000000000e-01,  2.14877032078447883e-01,  2.71463655707773492e-14,
+ 8.04687500000000000e-01,  2.17301275690033435e-01, -5.20400874340588377e-14,
+ 8.00781250000000000e-01,  2.22167465341044590e-01,  1.09706993205664329e-13,
+ 7.98828125000000000e-01,  2.24609468996732176e-01, -2.61365414529686436e-14,
+ 7.96875000000000000e-01,  2.27057450635356872e-01, -1.07873674987169095e-14,
+ 7.92968750000000000e-01,  2.31971465437709412e-01,  6.57309773783197502e-14,
+ 7.91015625000000000e-01,  2.34437557933006246e-01, -3.76018844589075005e-14,
+ 7.89062500000000000e-01,  2.36909747078470900e-01, -1.13185269120236874e-13,
+ 7.87109375000000000e-01,  2.39388063092746961e-01,  7.78417254957486279e-14,
+ 7.83203125000000000e-01,  2.44363197733036941e-01, -9.83420129626977822e-14,
+ 7.81250000000000000e-01,  2.46860077931614796e-01, -8.89985135656044422e-14,
+ 7.79296875000000000e-01,  2.49363208149588900e-01,  5.54285585311170864e-14,
+ 7.77343750000000000e-01,  2.51872619754976768e-01,  9.33123467794591751e-14,
+ 7.75390625000000000e-01,  2.54388344352264539e-01,  5.28323330087436998e-14,
+ 7.71484375000000000e-01,  2.59438860138288874e-01,  9.70422679206735652e-14,
+ 7.69531250000000000e-01,  2.61973715741532942e-01,  4.10265107169844624e-14,
+ 7.67578125000000000e-01,  2.64515013170239399e-01,  7.15002315301840152e-15,
+ 7.65625000000000000e-01,  2.67062785248981527e-01,  6.37194726981566678e-14,
+ 7.63671875000000000e-01,  2.69617065054035265e-01,  1.06748350881285256e-13,
+ 7.61718750000000000e-01,  2.72177885915880324e-01, -6.46510306400525555e-14,
+ 7.57812500000000000e-01,  2.77319285416297134e-01, -6.27905573266084430e-14,
+ 7.55859375000000000e-01,  2.79899932009811891e-01, -8.59129839362854615e-14,
+ 7.53906250000000000e-01,  2.82487255574778828e-01, -1.01904821335050882e-13,
+ 7.51953125000000000e-01,  2.85081290751804772e-01, -8.12113117496253991e-14,
+ 7.50000000000000000e-01,  2.87682072451843851e-01, -6.29235738900819503e-14,
+ 7.48046875000000000e-01,  2.90289635858925976e-01, -6.41814463766011635e-14,
+ 7.46093750000000000e-01,  2.92904016432885328e-01,  4.72745294051440629e-14,
+ 7.42187500000000000e-01,  2.98153372319120535e-01, -4.42040833387556859e-14,
+ 7.40234375000000000e-01,  3.00788419957143560e-01, -6.21232304808421408e-14,
+ 7.38281250000000000e-01,  3.03430429419904613e-01,  1.54834599349808308e-14,
+ 7.36328125000000000e-01,  3.06079437591506576e-01, -9.55418156600114957e-15,
+ 7.34375000000000000e-01,  3.08735481649591748e-01,  2.15221274916428878e-14,
+ 7.32421875000000000e-01,  3.11398599069207194e-01, -1.10224121610414440e-13,
+ 7.30468750000000000e-01,  3.14068827625078484e-01, -1.02632807552610639e-13,
+ 7.28515625000000000e-01,  3.16746205395702418e-01, -1.01747533775075609e-14,
+ 7.26562500000000000e-01,  3.19430770766302885e-01,  5.83435742009092355e-14,
+ 7.24609375000000000e-01,  3.22122562432014092e-01,  5.85531679270941548e-14,
+ 7.22656250000000000e-01,  3.24821619401291173e-01, -5.35164660425954100e-14,
+ 7.20703125000000000e-01,  3.27527980999093415e-01, -1.12817350606855236e-13,
+ 7.18750000000000000e-01,  3.30241686870522244e-01,  5.46121444899202154e-14,
+ 7.16796875000000000e-01,  3.32962776984913944e-01,  2.35691017512902041e-14,
+ 7.14843750000000000e-01,  3.35691291638113398e-01,  2.81369699012273384e-14,
+ 7.12890625000000000e-01,  3.38427271457021561e-01, -5.28015620472906423e-15,
+ 7.10937500000000000e-01,  3.41170757402778690e-01, -1.15656862461642304e-14,
+ 7.08984375000000000e-01,  3.43921790774629699e-01,  2.73065189213470885e-14,
+ 7.07031250000000000e-01,  3.46680413213789507e-01, -5.27782001886426930e-14,
+ 7.05078125000000000e-01,  3.49446666706626274e-01,  5.90346888093064038e-16,
+ 7.03125000000000000e-01,  3.52220593589436248e-01, -8.41491819348919478e-14,
+ 7.01171875000000000e-01,  3.55002236551172246e-01,  5.66661803098967488e-14,
+ 6.99218750000000000e-01,  3.57791638638900622e-01, -9.31428669422827609e-14,
+ 6.97265625000000000e-01,  3.60588843259847636e-01,  2.10723688503614244e-14,
+ 6.95312500000000000e-01,  3.63393894187538535e-01, -6.12077313605551215e-14,
+ 6.93359375000000000e-01,  3.66206835564071298e-01,  2.06908300604142468e-14,
+ 6.91406250000000000e-01,  3.69027711905800970e-01, -6.76369446683829350e-14,
+ 6.89453125000000000e-01,  3.71856568106295526e-01, -8.45090175564329015e-14,
+ 6.87500000000000000e-01,  3.74693449441338089e-01,  7.26046614992563736e-14,
+ 6.85546875000000000e-01,  3.77538401573701776e-01, -5.98016990093400611e-14,
+ 6.83593750000000000e-01,  3.80391470556105560e-01, -5.71387772165261083e-14,
+ 6.81640625000000000e-01,  3.83252702837125980e-01, -4.53587396333084353e-14,
+ 6.79687500000000000e-01,  3.86122145265062500e-01, -2.90523328608405340e-14,
+ 6.77734375000000000e-01,  3.88999845092712349e-01, -6.37561584590692184e-14,
+ 6.75781250000000000e-01,  3.91885849981690626e-01,  9.29023949891768584e-14,
+ 6.73828125000000000e-01,  3.94780208008114641e-01,  3.33865364451102179e-14,
+ 6.71875000000000000e-01,  3.97682967666014520e-01,  9.49133940309621507e-14,
+ 6.71875000000000000e-01,  3.97682967666014520e-01,  9.49133940309621507e-14,
+ 6.69921875000000000e-01,  4.00594177873472290e-01,  9.55792090472350018e-14,
+ 6.67968750000000000e-01,  4.03513887976941987e-01, -3.93547517080431915e-14,
+ 6.66015625000000000e-01,  4.06442147756024497e-01, -3.35018658529844937e-14,
+ 6.64062500000000000e-01,  4.09379007429379271e-01, -7.85602730195113479e-14,
+ 6.62109375000000000e-01,  4.12324517659044432e-01,  1.30931388084467035e-14,
+ 6.60156250000000000e-01,  4.15278729556575854e-01, -8.68508451904851286e-14,
+ 6.58203125000000000e-01,  4.18241694687139898e-01,  6.16252654031372466e-15,
+ 6.58203125000000000e-01,  4.18241694687139898e-01,  6.16252654031372466e-15,
+ 6.56250000000000000e-01,  4.21213465076334614e-01, -3.10638375410036164e-14,
+ 6.54296875000000000e-01,  4.24194093214509849e-01, -6.84981374161184723e-14,
+ 6.52343750000000000e-01,  4.27183632062906327e-01, -9.89585315574703768e-14,
+ 6.50390625000000000e-01,  4.30182135059112625e-01, -4.86671344118829156e-14,
+ 6.48437500000000000e-01,  4.33189656122976885e-01,  4.23575007881983986e-14,
+ 6.46484375000000000e-01,  4.36206249662518530e-01, -7.36464150964844309e-14,
+ 6.46484375000000000e-01,  4.36206249662518530e-01, -7.36464150964844309e-14,
+ 6.44531250000000000e-01,  4.39231970578930486e-01,  5.13790534544463761e-14,
+ 6.42578125000000000e-01,  4.42266874274082511e-01,  5.33818638407212217e-14,
+ 6.40625000000000000e-01,  4.45311016655296044e-01,  6.80090273603923766e-14,
+ 6.38671875000000000e-01,  4.48364454142165414e-01,  8.89790412707020426e-14,
+ 6.36718750000000000e-01,  4.51427243672696932e-01,  1.03209519617024597e-13,
+ 6.36718750000000000e-01,  4.51427243672696932e-01,  1.03209519617024597e-13,
+ 6.34765625000000000e-01,  4.54499442709675350e-01,  9.49497392823850593e-14,
+ 6.32812500000000000e-01,  4.57581109247257700e-01, -7.92998503041794534e-14,
+ 6.30859375000000000e-01,  4.60672301816885010e-01, -3.37658427926625980e-14,
+ 6.28906250000000000e-01,  4.63773079495013008e-01,  8.64718808389985556e-14,
+ 6.28906250000000000e-01,  4.63773079495013008e-01,  8.64718808389985556e-14,
+ 6.26953125000000000e-01,  4.66883501909478582e-01,  1.33379628842114449e-14,
+ 6.25000000000000000e-01,  4.70003629245638876e-01,  9.66771960323556644e-14,
+ 6.23046875000000000e-01,  4.73133522254556738e-01,  1.06475902528497790e-13,
+ 6.23046875000000000e-01,  4.73133522254556738e-01,  1.06475902528497790e-13,
+ 6.21093750000000000e-01,  4.76273242259367180e-01, -3.62301423120661295e-14,
+ 6.19140625000000000e-01,  4.79422851162325969e-01, -9.87986433917432049e-14,
+ 6.17187500000000000e-01,  4.82582411452540327e-01,  5.53443020754016186e-14,
+ 6.15234375000000000e-01,  4.85751986213927012e-01, -5.22894455858136139e-14,
+ 6.15234375000000000e-01,  4.85751986213927012e-01, -5.22894455858136139e-14,
+ 6.13281250000000000e-01,  4.88931639131351403e-01, -9.69852801365864597e-14,
+ 6.11328125000000000e-01,  4.92121434499267707e-01,  8.68610795625214486e-14,
+ 6.09375000000000000e-01,  4.95321437230131778e-01, -1.06348996485324508e-13,
+ 6.09375000000000000e-01,  4.95321437230131778e-01, -1.06348996485324508e-13,
+ 6.07421875000000000e-01,  4.98531712860312837e-01, -3.91861512700987923e-14,
+ 6.05468750000000000e-01,  5.01752327560325284e-01, -9.42933131988520288e-15,
+ 6.03515625000000000e-01,  5.04983348141649913e-01,  1.12410014119091271e-13,
+ 6.03515625000000000e-01,  5.04983348141649913e-01,  1.12410014119091271e-13,
+ 6.01562500000000000e-01,  5.08224842065828852e-01,  1.04464397848334708e-13,
+ 5.99609375000000000e-01,  5.11476877452423651e-01, -1.13019381922301333e-13,
+ 5.99609375000000000e-01,  5.11476877452423651e-01, -1.13019381922301333e-13,
+ 5.97656250000000000e-01,  5.14739523087200723e-01, -7.37109413887988535e-14,
+ 5.95703125000000000e-01,  5.18012848432135797e-01, -3.96359356195671095e-14,
+ 5.93750000000000000e-01,  5.21296923633371989e-01, -8.59020491840276388e-14,
+ 5.93750000000000000e-01,  5.21296923633371989e-01, -8.59020491840276388e-14,
+ 5.91796875000000000e-01,  5.24591819530087378e-01,  5.12648324329132412e-14,
+ 5.89843750000000000e-01,  5.27897607664726820e-01, -8.86735342637892274e-14,
+ 5.89843750000000000e-01,  5.27897607664726820e-01, -8.86735342637892274e-14,
+ 5.87890625000000000e-01,  5.31214360290732657e-01, -1.00600545063191575e-13,
+ 5.85937500000000000e-01,  5.34542150383231274e-01,  7.54515879875456669e-14,
+ 5.85937500000000000e-01,  5.34542150383231274e-01,  7.54515879875456669e-14,
+ 5.83984375000000000e-01,  5.37881051648810171e-01,  1.11867218946776542e-14,
+ 5.82031250000000000e-01,  5.41231138534158163e-01, -5.48283108114686740e-14,
+ 5.82031250000000000e-01,  5.41231138534158163e-01, -5.48283108114686740e-14,
+ 5.80078125000000000e-01,  5.44592486236751938e-01,  5.62283850851588705e-14,
+ 5.78125000000000000e-01,  5.47965170715542627e-01, -9.52144318878673628e-14,
+ 5.78125000000000000e-01,  5.47965170715542627e-01, -9.52144318878673628e-14,
+ 5.76171875000000000e-01,  5.51349268699595996e-01,  9.19638252540546797e-14,
+ 5.74218750000000000e-01,  5.54744857700825378e-01,  7.95898808074715041e-16,
+ 5.74218750000000000e-01,  5.54744857700825378e-01,  7.95898808074715041e-16,
+ 5.72265625000000000e-01,  5.58152016022404496e-01,  3.59830721455049435e-14,
+ 5.70312500000000000e-01,  5.61570822771273015e-01, -4.69781220500010171e-14,
+ 5.70312500000000000e-01,  5.61570822771273015e-01, -4.69781220500010171e-14,
+ 5.68359375000000000e-01,  5.65001357867913612e-01,  1.01659544226541666e-13,
+ 5.66406250000000000e-01,  5.68443702059084899e-01, -9.68252383816349788e-14,
+ 5.66406250000000000e-01,  5.68443702059084899e-01, -9.68252383816349788e-14,
+ 5.64453125000000000e-01,  5.71897936927143746e-01, -6.81220324734182663e-14,
+ 5.62500000000000000e-01,  5.75364144903460328e-01,  1.01526527663068159e-13,
+ 5.62500000000000000e-01,  5.75364144903460328e-01,  1.01526527663068159e-13,
+ 5.60546875000000000e-01,  5.78842409279786807e-01,  9.98687637094707105e-14,
+ 5.58593750000000000e-01,  5.82332814219626016e-01,  2.91792389040138093e-14,
+ 5.58593750000000000e-01,  5.82332814219626016e-01,  2.91792389040138093e-14,
+ 5.56640625000000000e-01,  5.85835444770964386e-01, -1.07127657228837636e-13,
+ 5.56640625000000000e-01,  5.85835444770964386e-01, -1.07127657228837636e-13,
+ 5.54687500000000000e-01,  5.89350386878322752e-01, -2.10071357848577060e-14,
+ 5.52734375000000000e-01,  5.92877727396171395e-01,  9.87656063578676970e-14,
+ 5.52734375000000000e-01,  5.92877727396171395e-01,  9.87656063578676970e-14,
+ 5.50781250000000000e-01,  5.96417554101435599e-01, -4.14014463984390625e-14,
+ 5.50781250000000000e-01,  5.96417554101435599e-01, -4.14014463984390625e-14,
+ 5.48828125000000000e-01,  5.99969955705773828e-01, -1.18078549845452716e-14,
+ 5.46875000000000000e-01,  6.03535021870357014e-01, -9.88367430617980611e-14,
+ 5.46875000000000000e-01,  6.03535021870357014e-01, -9.88367430617980611e-14,
+ 5.44921875000000000e-01,  6.07112843218146736e-01, -4.57999968917270927e-15,
+ 5.44921875000000000e-01,  6.07112843218146736e-01, -4.57999968917270927e-15,
+ 5.42968750000000000e-01,  6.10703511348901884e-01, -3.11658991737944332e-14,
+ 5.41015625000000000e-01,  6.14307118852138956e-01,  3.03290411253175955e-14,
+ 5.41015625000000000e-01,  6.14307118852138956e-01,  3.03290411253175955e-14,
+ 5.39062500000000000e-01,  6.17923759322366095e-01, -8.31142940016173182e-15,
+ 5.39062500000000000e-01,  6.17923759322366095e-01, -8.31142940016173182e-15,
+ 5.37109375000000000e-01,  6.21553527372952885e-01, -1.63938520663480686e-14,
+ 5.35156250000000000e-01,  6.25196518651364386e-01,  7.31742902172525233e-14,
+ 5.35156250000000000e-01,  6.25196518651364386e-01,  7.31742902172525233e-14,
+ 5.33203125000000000e-01,  6.28852829854622541e-01, -7.44892601362461870e-14,
+ 5.33203125000000000e-01,  6.28852829854622541e-01, -7.44892601362461870e-14,
+ 5.31250000000000000e-01,  6.32522558743403351e-01,  1.07115436578448759e-13,
+ 5.31250000000000000e-01,  6.32522558743403351e-01,  1.07115436578448759e-13,
+ 5.29296875000000000e-01,  6.36205804159772015e-01,  3.48698307515187540e-14,
+ 5.29296875000000000e-01,  6.36205804159772015e-01,  3.48698307515187540e-14,
+ 5.27343750000000000e-01,  6.39902666041052726e-01,  8.03009196182581613e-14,
+ 5.25390625000000000e-01,  6.43613245437563819e-01,  1.04859539295065137e-13,
+ 5.25390625000000000e-01,  6.43613245437563819e-01,  1.04859539295065137e-13,
+ 5.23437500000000000e-01,  6.47337644528761302e-01, -1.10196103261390425e-13,
+ 5.23437500000000000e-01,  6.47337644528761302e-01, -1.10196103261390425e-13,
+ 5.21484375000000000e-01,  6.51075966639155013e-01,  1.03242370192594988e-13,
+ 5.21484375000000000e-01,  6.51075966639155013e-01,  1.03242370192594988e-13,
+ 5.19531250000000000e-01,  6.54828316257862753e-01, -5.40423128349493112e-14,
+ 5.19531250000000000e-01,  6.54828316257862753e-01, -5.40423128349493112e-14,
+ 5.17578125000000000e-01,  6.58594799053389579e-01, -1.04003047832860574e-13,
+ 5.17578125000000000e-01,  6.58594799053389579e-01, -1.04003047832860574e-13,
+ 5.15625000000000000e-01,  6.62375521893181940e-01,  9.68108760917442485e-15,
+ 5.13671875000000000e-01,  6.66170592861817568e-01, -7.43339400877165816e-14,
+ 5.13671875000000000e-01,  6.66170592861817568e-01, -7.43339400877165816e-14,
+ 5.11718750000000000e-01,  6.69980121278513252e-01, -1.02320848213047991e-13,
+ 5.11718750000000000e-01,  6.69980121278513252e-01, -1.02320848213047991e-13,
+ 5.09765625000000000e-01,  6.73804217716906351e-01, -9.19759067509224844e-14,
+ 5.09765625000000000e-01,  6.73804217716906351e-01, -9.19759067509224844e-14,
+ 5.07812500000000000e-01,  6.77642994023926803e-01,  5.32517734371131001e-14,
+ 5.07812500000000000e-01,  6.77642994023926803e-01,  5.32517734371131001e-14,
+ 5.05859375000000000e-01,  6.81496563340033390e-01, -6.33546955387890289e-14,
+ 5.05859375000000000e-01,  6.81496563340033390e-01, -6.33546955387890289e-14,
+ 5.03906250000000000e-01,  6.85365040117858371e-01,  3.19898201408802003e-14,
+ 5.03906250000000000e-01,  6.85365040117858371e-01,  3.19898201408802003e-14,
+ 5.01953125000000000e-01,  6.89248540144262734e-01,  2.52528832861547634e-14,
+ 5.01953125000000000e-01,  6.89248540144262734e-01,  2.52528832861547634e-14,
+ 5.00000000000000000e-01,  6.93147180559890330e-01,  5.49792301870837116e-14,
+};
@@ -0,0 +1,494 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __k_cr_exp, __k_cr_log and __k_cr_pow: the slow paths of cr_exp,
+ * cr_log and cr_pow, used when the double-double result of the fast
+ * path is too close to a rounding boundary to decide the rounding.
+ *
+ * They work in fixed point with 288-bit two's complement numbers
+ * held in NW 32-bit words, most significant first: one integer word
+ * followed by eight fraction words, so that the unit in the last
+ * place is 2^-256.  Products are formed with 64-bit integer multiplies
+ * and truncated to 256 fraction bits.
+ *
+ * exp(t) = 2^k * exp(r)^4096, where r = (t - k*ln2)/4096, and exp(r)
+ * is summed from its Taylor series; the result has a relative error
+ * of about 2^-238.  log(x) is found from the fast path's result by
+ * two steps of Newton's method, u += x*exp(-u) - 1, after which its
+ * absolute error is about 2^-236, or a relative error less than
+ * 2^-180 since |log(x)| > 2^-54 for x != 1.  x**y is exp(y*log|x|),
+ * good to more than 170 bits.
+ *
+ * mp_round rounds to nearest double.  The results of exp and log
+ * are never exactly halfway between two doubles, but those of pow
+ * can be, so a value that agrees with a halfway point in its first
+ * LIMBIT bits (more than the worst cases known for exp and log need
+ * by a wide margin) is taken to be that point and rounded to even.
+ */
+
+#include "libm.h"
+#include <float.h>		/* DBL_MIN */
+#include <sys/types.h>
+
+#define	NW	9		/* words in a number */
+#define	LIMBIT	160		/* bits examined by mp_round */
+
+/* ln2 in 256 fraction bits */
+static const unsigned ln2w[NW] = {
+	0x00000000, 0xb17217f7, 0xd1cf79ab, 0xc9e3b398, 0x03f2f6af,
+	0x40f34326, 0x7298b62d, 0x8a0d175b, 0x8baafa2b,
+};
+
+static const double
+	one	= 1.0,
+	half	= 0.5,
+	two52	= 4503599627370496.0,
+	twom32	= 2.3283064365386962890625e-10,
+	invln2	= 1.44269504088896338700e+00;	/* 0x3ff71547, 0x652b82fe */
+
+static void
+mp_copy(unsigned *c, const unsigned *a) {
+	int	i;
+
+	for (i = 0; i < NW; i++)
+		c[i] = a[i];
+}
+
+static int
+mp_iszero(const unsigned *a) {
+	int	i;
+
+	for (i = 0; i < NW; i++)
+		if (a[i] != 0)
+			return (0);
+	return (1);
+}
+
+/* c = a + b */
+static void
+mp_add(unsigned *c, const unsigned *a, const unsigned *b) {
+	uint64_t	t;
+	int		i;
+
+	t = 0;
+	for (i = NW - 1; i >= 0; i--) {
+		t += (uint64_t)a[i] + b[i];
+		c[i] = (unsigned)t;
+		t >>= 32;
+	}
+}
+
+/* c = a - b */
+static void
+mp_sub(unsigned *c, const unsigned *a, const unsigned *b) {
+	uint64_t	t;
+	int		i;
+
+	t = 1;
+	for (i = NW - 1; i >= 0; i--) {
+		t += (uint64_t)a[i] + (unsigned)~b[i];
+		c[i] = (unsigned)t;
+		t >>= 32;
+	}
+}
+
+/* c = -a */
+static void
+mp_neg(unsigned *c, const unsigned *a) {
+	uint64_t	t;
+	int		i;
+
+	t = 1;
+	for (i = NW - 1; i >= 0; i--) {
+		t += (unsigned)~a[i];
+		c[i] = (unsigned)t;
+		t >>= 32;
+	}
+}
+
+/* c = |a|; return 1 if a < 0 */
+static int
+mp_abs(unsigned *c, const unsigned *a) {
+	if ((int)a[0] < 0) {
+		mp_neg(c, a);
+		return (1);
+	}
+	mp_copy(c, a);
+	return (0);
+}
+
+/* c = a * 2^-n, n >= 0, rounding toward -inf */
+static void
+mp_shr(unsigned *c, const unsigned *a, int n) {
+	unsigned	s;
+	int		i, j, w, b;
+
+	s = ((int)a[0] < 0) ? 0xffffffff : 0;
+	w = n >> 5;
+	b = n & 31;
+	for (i = NW - 1; i >= 0; i--) {
+		j = i - w;
+		if (b == 0)
+			c[i] = (j >= 0) ? a[j] : s;
+		else
+			c[i] = (((j >= 0) ? a[j] : s) >> b) |
+			    (((j >= 1) ? a[j - 1] : s) << (32 - b));
+	}
+}
+
+/* c = a * 2^n, n >= 0 */
+static void
+mp_shl(unsigned *c, const unsigned *a, int n) {
+	int	i, j, w, b;
+
+	w = n >> 5;
+	b = n & 31;
+	for (i = 0; i < NW; i++) {
+		j = i + w;
+		if (b == 0)
+			c[i] = (j < NW) ? a[j] : 0;
+		else
+			c[i] = (((j < NW) ? a[j] : 0) << b) |
+			    (((j + 1 < NW) ? a[j + 1] : 0) >> (32 - b));
+	}
+}
+
+/* c = a * b, truncated toward zero */
+static void
+mp_mul(unsigned *c, const unsigned *a, const unsigned *b) {
+	unsigned	p[NW + NW], u[NW], v[NW];
+	uint64_t	t;
+	int		i, j, s;
+
+	s = mp_abs(u, a) ^ mp_abs(v, b);
+	for (i = 0; i < NW + NW; i++)
+		p[i] = 0;
+	for (i = NW - 1; i >= 0; i--) {
+		if (u[i] == 0)
+			continue;
+		t = 0;
+		for (j = NW - 1; j >= 0; j--) {
+			t += (uint64_t)u[i] * v[j] + p[i + j + 1];
+			p[i + j + 1] = (unsigned)t;
+			t >>= 32;
+		}
+		p[i] = (unsigned)t;
+	}
+	for (i = 0; i < NW; i++)
+		c[i] = p[i + 1];
+	if (s)
+		mp_neg(c, c);
+}
+
+/* c = a * k, truncated toward zero */
+static void
+mp_mul_i(unsigned *c, const unsigned *a, int k) {
+	uint64_t	t;
+	unsigned	m;
+	int		i, s;
+
+	s = mp_abs(c, a);
+	if (k < 0) {
+		s ^= 1;
+		m = -k;
+	} else {
+		m = k;
+	}
+	t = 0;
+	for (i = NW - 1; i >= 0; i--) {
+		t += (uint64_t)c[i] * m;
+		c[i] = (unsigned)t;
+		t >>= 32;
+	}
+	if (s)
+		mp_neg(c, c);
+}
+
+/* c = a / m, truncated toward zero */
+static void
+mp_div_i(unsigned *c, const unsigned *a, unsigned m) {
+	uint64_t	t;
+	int		i, s;
+
+	s = mp_abs(c, a);
+	t = 0;
+	for (i = 0; i < NW; i++) {
+		t = (t << 32) | c[i];
+		c[i] = (unsigned)(t / m);
+		t %= m;
+	}
+	if (s)
+		mp_neg(c, c);
+}
+
+/* c = x, for |x| < 2^31; bits of x below 2^-256 are dropped */
+static void
+mp_set_d(unsigned *c, double x) {
+	uint64_t	m;
+	int		i, e, hx;
+
+	for (i = 0; i < NW; i++)
+		c[i] = 0;
+	hx = ((int *)&x)[HIWORD];
+	e = ((hx >> 20) & 0x7ff) - 0x433 + 256;	/* position of lsb */
+	if (e <= -53 || ((hx << 1) | ((int *)&x)[LOWORD]) == 0)
+		return;
+	m = ((uint64_t)((hx & 0xfffff) | 0x100000) << 32) |
+	    (unsigned)((int *)&x)[LOWORD];
+	if (e < 0) {
+		m >>= -e;
+		e = 0;
+	}
+	i = NW - 1 - (e >> 5);
+	e &= 31;
+	c[i] = (unsigned)(m << e);
+	if (i >= 1)
+		c[i - 1] = (unsigned)((m << e) >> 32);
+	if (i >= 2 && e != 0)
+		c[i - 2] = (unsigned)(m >> (64 - e));
+	if (hx < 0)
+		mp_neg(c, c);
+}
+
+/* return a, roughly */
+static double
+mp_get_d(const unsigned *a) {
+	unsigned	u[NW];
+	double		d;
+	int		s;
+
+	s = mp_abs(u, a);
+	d = (double)u[0] + twom32 * ((double)u[1] + twom32 *
+	    ((double)u[2] + twom32 * (double)u[3]));
+	return (s ? -d : d);
+}
+
+/* bit i of a, where bit 0 is the units bit and bit i has weight 2^-i */
+#define	BIT(a, i) \
+	((i) == 0 ? (a)[0] & 1 : ((a)[(((i) - 1) >> 5) + 1] >> \
+	    (31 - (((i) - 1) & 31))) & 1)
+
+/*
+ * Round a * 2^k to the nearest double *z.  Return 1 if it overflows,
+ * -1 if it rounds to zero, and 0 otherwise.
+ */
+static int
+mp_round(double *z, const unsigned *a, int k) {
+	unsigned	u[NW];
+	uint64_t	m;
+	int		i, j, s, p, rb, zeros, ones;
+
+	s = mp_abs(u, a);
+	if (mp_iszero(u)) {
+		*z = 0.0;
+		return (0);
+	}
+
+	/* normalize so that 1 <= u < 2 */
+	if (u[0] != 0) {
+		for (j = 0; (u[0] >> j) > 1; j++)
+			;
+		mp_shr(u, u, j);
+		k += j;
+	} else {
+		for (i = 1; u[i] == 0; i++)
+			;
+		for (j = 0; (u[i] << j) < 0x80000000u; j++)
+			;
+		j += (i - 1) * 32 + 1;
+		mp_shl(u, u, j);
+		k -= j;
+	}
+	if (k > 1023)
+		return (1);
+
+	/* keep p bits: 53, or fewer if the result is subnormal */
+	p = (k >= -1022) ? 53 : 1075 + k;
+	if (p < 0) {
+		*z = 0.0;
+		return (-1);
+	}
+	m = 0;
+	for (i = 0; i < p; i++)
+		m = (m << 1) | BIT(u, i);
+	rb = BIT(u, p);
+	zeros = ones = 1;
+	for (i = p + 1; i <= LIMBIT; i++) {
+		if (BIT(u, i))
+			zeros = 0;
+		else
+			ones = 0;
+	}
+	if (rb)
+		m += (zeros) ? (m & 1) : 1;
+	else if (ones)
+		m += m & 1;
+	if (m == 0) {
+		*z = 0.0;
+		return (-1);
+	}
+	if (k == 1023 && m == ((uint64_t)1 << 53))
+		return (1);
+	*z = scalbn((double)m, k - p + 1);
+	if (s)
+		*z = -*z;
+#if !defined(__lint)
+	if (p < 53 && !(rb == 0 && zeros)) {
+		/* inexact subnormal result */
+		volatile double dummy = DBL_MIN * DBL_MIN;
+	}
+#endif
+	return (0);
+}
+
+/*
+ * Set e and return k such that exp(t) = e * 2^k, for |t| < 2^30;
+ * 0.7 < e < 1.42.
+ */
+static int
+mp_exp(unsigned *e, const unsigned *t) {
+	unsigned	r[NW], u[NW];
+	double		d;
+	unsigned	i;
+	int		k;
+
+	d = mp_get_d(t) * invln2;
+	k = (int)((d < 0.0) ? d - half : d + half);
+	mp_mul_i(r, ln2w, k);
+	mp_sub(r, t, r);
+	mp_shr(r, r, 12);
+
+	/* e = 1 + r + r^2/2! + ... */
+	mp_copy(e, r);
+	e[0] += 1;
+	mp_copy(u, r);
+	for (i = 2; ; i++) {
+		mp_mul(u, u, r);
+		mp_div_i(u, u, i);
+		if (mp_iszero(u))
+			break;
+		mp_add(e, e, u);
+	}
+	for (i = 0; i < 12; i++)
+		mp_mul(e, e, e);
+	return (k);
+}
+
+/*
+ * Set u = log(x * 2^n), x > 0 normal, starting from the approximation
+ * yh + yl.
+ */
+static void
+mp_log(unsigned *u, double x, int n, double yh, double yl) {
+	unsigned	m[NW], v[NW], w[NW];
+	int		i, k;
+
+	n += (((int *)&x)[HIWORD] >> 20) - 0x3ff;
+	((int *)&x)[HIWORD] = (((int *)&x)[HIWORD] & 0x000fffff) | 0x3ff00000;
+	mp_set_d(m, x);
+	mp_set_d(u, yh);
+	mp_set_d(w, yl);
+	mp_add(u, u, w);
+	for (i = 0; i < 2; i++) {
+		mp_neg(v, u);
+		k = mp_exp(w, v);
+		mp_mul(w, w, m);		/* x * exp(-u) = w * 2^(n+k) */
+		k += n;
+		if (k > 0)
+			mp_shl(w, w, k);
+		else if (k < 0)
+			mp_shr(w, w, -k);
+		w[0] -= 1;
+		mp_add(u, u, w);
+	}
+}
+
+double
+__k_cr_exp(double x) {
+	unsigned	t[NW], e[NW];
+	double		z;
+	int		i, k;
+
+	mp_set_d(t, x);
+	k = mp_exp(e, t);
+	i = mp_round(&z, e, k);
+	if (i > 0)
+		return (_SVID_libm_err(x, x, 6));
+	if (i < 0)
+		return (_SVID_libm_err(x, x, 7));
+	return (z);
+}
+
+/* log(x * 2^n), given yh + yl close to it */
+double
+__k_cr_log(double x, int n, double yh, double yl) {
+	unsigned	u[NW];
+	double		z;
+
+	mp_log(u, x, n, yh, yl);
+	(void) mp_round(&z, u, 0);
+	return (z);
+}
+
+/*
+ * x**y for finite x, y, given lh + ll close to log|x|; the result is
+ * negated if neg is nonzero.  x**y must not be 1 rounded, nor far
+ * outside the range of double.
+ */
+double
+__k_cr_pow(double x, double y, double lh, double ll, int neg) {
+	unsigned	l[NW], t[NW], e[NW];
+	double		ax, z;
+	int		i, k, n;
+
+	ax = fabs(x);
+	n = 0;
+	if (((int *)&ax)[HIWORD] < 0x00100000) {	/* subnormal x */
+		ax *= two52;
+		n = -52;
+	}
+	mp_log(l, ax, n, lh, ll);
+
+	/* y = z * 2^k, 1 <= |z| < 2 */
+	z = y;
+	k = ((((int *)&z)[HIWORD] >> 20) & 0x7ff) - 0x3ff;
+	((int *)&z)[HIWORD] = (((int *)&z)[HIWORD] & 0x800fffff) | 0x3ff00000;
+	mp_set_d(t, z);
+	mp_mul(t, t, l);
+	if (k > 0)
+		mp_shl(t, t, k);
+	else if (k < 0)
+		mp_shr(t, t, -k);
+
+	k = mp_exp(e, t);
+	i = mp_round(&z, e, k);
+	if (i > 0)
+		return (_SVID_libm_err(x, y, 21));
+	if (i < 0)
+		return (_SVID_libm_err(x, y, 22));
+	return ((neg) ? -z : z);
+}
@@ -0,0 +1,169 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * Run time selection of the x86 scalar libm entry points.
+ *
+ * Some entry points are compiled more than once, each time for a
+ * different instruction set; the Makefiles rename the bodies with
+ * -D__sin=__sin_sse2 and so on, and define LIBM_ISA_BODY so that
+ * none of them binds the public names.  Each __name is bound here
+ * to the best body the processor can run, and the ANSI name is
+ * bound the same way and made weak, as it is a weak alias of the
+ * __name elsewhere in libm (gcc will not take weak and ifunc
+ * together, hence the .weak directive).
+ *
+ *	i386	sin, cos, tan, atan, atan2, exp, log, pow and hypot:
+ *		the x87 assembly in i386/common, which uses fsin,
+ *		fpatan, fyl2x and the like, or the table driven C of
+ *		this directory compiled for SSE2 if SSE2 is present.
+ *		The SSE2 bodies are the same algorithms as on SPARC
+ *		and amd64, with the same error bounds, and do not
+ *		suffer the double rounding of x87 code.
+ *
+ *	amd64	exp, log and pow: the C of this directory, or the
+ *		same C compiled with LIBM_FMA_BODY, which fuses the
+ *		multiply-adds of the polynomials and reductions (see
+ *		FMADD in libm_macros.h), if AVX2 and FMA are present.
+ *		The error bounds are those of the plain bodies; the
+ *		FMA bodies take about 15% (exp) and 6% (log, pow)
+ *		less time per call.
+ *
+ * See __vlibm_ifunc.c for how the binding is done; as there, the
+ * pointers of the non-GNU stubs start out at the baseline bodies.
+ */
+
+#define	ISA_SSE2	1
+#define	ISA_AVX2	2
+
+extern int __vlibm_isa(void);
+
+#if defined(__amd64)
+
+#define	LO		sse2
+#define	HI		fma
+#define	HI_ISA		ISA_AVX2
+
+#define	ENTRIES(X)				\
+	X(exp, U)				\
+	X(log, U)				\
+	X(pow, B)
+
+#else
+
+#define	LO		x87
+#define	HI		sse2
+#define	HI_ISA		ISA_SSE2
+
+#define	ENTRIES(X)				\
+	X(atan, U)				\
+	X(atan2, B)				\
+	X(cos, U)				\
+	X(exp, U)				\
+	X(hypot, B)				\
+	X(log, U)				\
+	X(pow, B)				\
+	X(sin, U)				\
+	X(tan, U)
+
+#endif
+
+/*
+ * Parameter and argument lists of unary (sin) and binary (pow)
+ * entry points.
+ */
+#define	U_PARMS		(double x)
+#define	U_ARGS		(x)
+#define	B_PARMS		(double x, double y)
+#define	B_ARGS		(x, y)
+
+/* BODY(__sin, sse2) is __sin_sse2, after LO and HI are expanded */
+#define	BODY(f, isa)	BODY_(f, isa)
+#define	BODY_(f, isa)	f##_##isa
+
+#define	DECLARE(f, k)						\
+	extern double BODY(__##f, LO) k##_PARMS;		\
+	extern double BODY(__##f, HI) k##_PARMS;
+
+ENTRIES(DECLARE)
+
+#if defined(__GNUC__)
+
+#define	DEFINE(f, k)						\
+	static __typeof__(&BODY(__##f, LO))			\
+	__##f##_resolve(void)					\
+	{							\
+		return ((__vlibm_isa() >= HI_ISA)?		\
+		    BODY(__##f, HI) : BODY(__##f, LO));		\
+	}							\
+	double __##f k##_PARMS					\
+	    __attribute__((ifunc("__" #f "_resolve")));		\
+	double f k##_PARMS					\
+	    __attribute__((ifunc("__" #f "_resolve")));		\
+	__asm__(".weak " #f);
+
+ENTRIES(DEFINE)
+
+#else
+
+#pragma weak exp = __exp
+#pragma weak log = __log
+#pragma weak pow = __pow
+#if !defined(__amd64)
+#pragma weak atan = __atan
+#pragma weak atan2 = __atan2
+#pragma weak cos = __cos
+#pragma weak hypot = __hypot
+#pragma weak sin = __sin
+#pragma weak tan = __tan
+#endif
+
+#define	DEFINE(f, k)						\
+	static double (*__##f##_p) k##_PARMS = BODY(__##f, LO);	\
+								\
+	double							\
+	__##f k##_PARMS						\
+	{							\
+		return ((*__##f##_p) k##_ARGS);			\
+	}
+
+ENTRIES(DEFINE)
+
+#define	BIND(f, k)						\
+	__##f##_p = BODY(__##f, HI);
+
+static void
+__libm_ifunc_init(void)
+{
+	if (__vlibm_isa() >= HI_ISA) {
+		ENTRIES(BIND)
+	}
+}
+
+#pragma init(__libm_ifunc_init)
+
+#endif
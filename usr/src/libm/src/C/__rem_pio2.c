@@ -36,8 +36,6 @@
 
 #include "libm.h"
 
-extern const int _TBL_ipio2_inf[];
-
 /* INDENT OFF */
 /*
  * invpio2:  53 bits of 2/pi
@@ -62,8 +60,7 @@ static const double
 int
 __rem_pio2(double x, double *y) {
 	double	w, t, r, fn;
-	double	tx[3];
-	int	e0, i, j, nx, n, ix, hx, lx;
+	int	i, j, n, ix, hx;
 
 	hx = ((int *)&x)[HIWORD];
 	ix = hx & 0x7fffffff;
@@ -140,24 +137,8 @@ __rem_pio2(double x, double *y) {
 		return (n);
 	}
 
-	e0 = (ix >> 20) - 1046;	/* e0 = ilogb(x)-23; */
-
-	/* break x into three 24 bit pieces */
-	lx = ((int *)&x)[LOWORD];
-	i = (lx & 0x1f) << 19;
-	tx[2] = (double)i;
-	j = (lx >> 5) & 0xffffff;
-	tx[1] = (double)j;
-	tx[0] = (double)((((ix & 0xfffff) | 0x100000) << 3) |
-	    ((unsigned)lx >> 29));
-	nx = 3;
-	if (i == 0) {
-		/* skip zero term */
-		nx--;
-		if (j == 0)
-			nx--;
-	}
-	n = __rem_pio2m(tx, y, e0, nx, 2, _TBL_ipio2_inf);
+	/* |x| > 2^19 pi, reduce with integer arithmetic */
+	n = __rem_pio2i(x, y);
 	if (hx < 0) {
 		y[0] = -y[0];
 		y[1] = -y[1];
@@ -0,0 +1,198 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __rem_pio2i(x, y) passes back y[0] + y[1] = |x| - n*pi/2 with
+ * |y[0] + y[1]| <= pi/4 to at least 72 bits and returns n mod 8,
+ * for finite x with |x| >= 2^19.  The sign of x is ignored; the
+ * caller applies it to n and y.
+ *
+ * It does the same job as splitting x into 24-bit pieces and calling
+ * __rem_pio2m, but entirely in integer arithmetic, so it needs no
+ * scalbn or floor, no recomputation when the result is tiny, and no
+ * change of rounding precision on x86:
+ *
+ * Write |x| = m * 2^k with m a 53-bit integer.  Bits of 2/pi more
+ * than k + 3 places right of the binary point contribute multiples
+ * of 8 to |x| * 2/pi and can be skipped, so we take the 192 bits of
+ * 2/pi that follow them and multiply them by m, using 32-bit words
+ * and 64-bit products, keeping only the low 192 bits of the result.
+ * Of these, the low 189 are the fraction of |x| * 2/pi and the three
+ * above them are n mod 8.  Leaving out the rest of 2/pi perturbs the
+ * fraction by less than 2^-136, while the fraction of a double is
+ * never closer than about 2^-62 to an integer, so at least 74 good
+ * bits remain after cancellation.
+ *
+ * The fraction is rounded to the nearest integer, and the 96 bits of
+ * what remains, starting with its leading one, are multiplied by 96
+ * bits of pi/2, again with 64-bit products.  The top 96 bits of that
+ * product, good to about 2^-93, are split into a 53-bit and a 43-bit
+ * integer, each converted to double exactly, and the two are added
+ * to give y[0] and y[1].
+ */
+
+#include "libm.h"
+#include <sys/types.h>
+
+/* 2/pi in 32-bit words, preceded by three words of zeroes */
+static const unsigned ipio2w[] = {
+	0x00000000, 0x00000000, 0x00000000,
+	0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041,
+	0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c,
+	0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484, 0xe99c7026, 0xb45f7e41,
+	0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+	0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+	0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08,
+	0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d, 0xa9e39161, 0x5ee61b08,
+	0x6599855f, 0x14a06840, 0x8dffd880, 0x4d732731, 0x06061556, 0xca73a8c9,
+	0x60e27bc0,	0x00000000, 0x00000000,
+};
+
+/* pi/2 = (P0 * 2^64 + P1 * 2^32 + P2) * 2^-95 to 96 bits */
+#define	P0	0xc90fdaa2u
+#define	P1	0x2168c234u
+#define	P2	0xc4c6628bu
+
+static const double twom43 = 1.13686837721616029739e-13;
+
+int
+__rem_pio2i(double x, double *y) {
+	double		t, u, s;
+	uint64_t	u0, u1, v0, v1, acc, a, b;
+	unsigned	w[6], p[6], f[7], mh, ml, c, neg;
+	int		e, o, i, j, n;
+
+	/* |x| = (mh * 2^32 + ml) * 2^(e - 52) */
+	e = ((((int *)&x)[HIWORD] >> 20) & 0x7ff) - 0x3ff;
+	mh = (((int *)&x)[HIWORD] & 0xfffff) | 0x100000;
+	ml = ((int *)&x)[LOWORD];
+
+	/*
+	 * w = the 192 bits of 2/pi starting e - 54 places right of the
+	 * binary point, least significant word first; the leading 96
+	 * zero bits of ipio2w keep the offset o positive for e >= -36
+	 */
+	o = e + 41;
+	i = (o >> 5) + 5;
+	j = o & 31;
+	for (n = 0; n < 6; n++)
+		w[n] = (unsigned)(((((uint64_t)ipio2w[i-n] << 32) |
+		    ipio2w[i-n+1]) << j) >> 32);
+
+	/*
+	 * p = the low 192 bits of (mh * 2^32 + ml) * w, least significant
+	 * word first; the bits above these are multiples of 8
+	 */
+	u0 = (uint64_t)ml * w[0];
+	p[0] = (unsigned)u0;
+	u1 = (uint64_t)ml * w[1];
+	v0 = (uint64_t)mh * w[0];
+	acc = (u0 >> 32) + (u1 & 0xffffffff) + (v0 & 0xffffffff);
+	p[1] = (unsigned)acc;
+	for (n = 2; n < 6; n++) {
+		u0 = u1;
+		v1 = v0;
+		u1 = (uint64_t)ml * w[n];
+		v0 = (uint64_t)mh * w[n-1];
+		acc = (acc >> 32) + (u1 & 0xffffffff) + (u0 >> 32) +
+		    (v0 & 0xffffffff) + (v1 >> 32);
+		p[n] = (unsigned)acc;
+	}
+
+	/*
+	 * |x| * 2/pi = p * 2^-189 mod 8: the integer part is in bits
+	 * 29-31 of p[5]; shift the fraction up so that it fills f, most
+	 * significant word first
+	 */
+	n = (int)(p[5] >> 29);
+	for (i = 0; i < 5; i++)
+		f[i] = (p[5-i] << 3) | (p[4-i] >> 29);
+	f[5] = p[0] << 3;
+	f[6] = 0;
+
+	/*
+	 * round to the nearest integer, leaving |fraction| in f and its
+	 * sign in neg; the negation is done with a mask to avoid a
+	 * branch that goes either way
+	 */
+	neg = f[0] >> 31;
+	n += neg;
+	c = neg;
+	for (i = 5; i >= 0; i--) {
+		f[i] = (f[i] ^ -neg) + c;
+		c &= (f[i] == 0);
+	}
+
+	/*
+	 * a:b = the 96 bits of f starting with its leading one, so that
+	 * the fraction is (a * 2^32 + b) * 2^-(96 + 32 * i + j); since
+	 * the fraction is at least 2^-62 or so, i is at most 1, and the
+	 * exponent of f[i] converted to double gives j
+	 */
+	for (i = 0; f[i] == 0; i++)
+		;
+	t = (double)(int64_t)f[i];
+	j = 0x41e - ((((int *)&t)[HIWORD] >> 20) & 0x7ff);
+	a = ((((uint64_t)f[i] << 32) | f[i+1]) << j) |
+	    ((uint64_t)f[i+2] >> (32 - j));
+	b = ((((uint64_t)f[i+2] << 32) | f[i+3]) << j) >> 32;
+	e = 32 * i + j;
+
+	/*
+	 * the top 96 bits of (a * 2^32 + b) * (P0 * 2^64 + P1 * 2^32 + P2),
+	 * most significant word in p[0], leaving out the partial products
+	 * below the fourth word; then |y| = p * 2^-(95 + e)
+	 */
+	u0 = (a >> 32) * P0;
+	u1 = (a >> 32) * P1;
+	v0 = (a & 0xffffffff) * P0;
+	v1 = (a & 0xffffffff) * P1;
+	acc = ((a >> 32) * P2 & 0xffffffff) + (v1 & 0xffffffff) +
+	    (b * P0 & 0xffffffff) + ((a & 0xffffffff) * P2 >> 32) +
+	    (b * P1 >> 32);
+	acc = (acc >> 32) + ((a >> 32) * P2 >> 32) + (v1 >> 32) +
+	    (b * P0 >> 32) + (u1 & 0xffffffff) + (v0 & 0xffffffff);
+	p[2] = (unsigned)acc;
+	acc = (acc >> 32) + (u1 >> 32) + (v0 >> 32) + (u0 & 0xffffffff);
+	p[1] = (unsigned)acc;
+	p[0] = (unsigned)((acc >> 32) + (u0 >> 32));
+
+	/*
+	 * split p into its top 53 bits and the other 43, convert both,
+	 * and add them; p[0] >= 2^30, so the first conversion is exact
+	 * and the sum is normalized; the sign goes into the scale factor
+	 */
+	a = ((uint64_t)p[0] << 32) | p[1];
+	b = ((a & 0x7ff) << 32) | p[2];
+	((int *)&s)[HIWORD] = (neg << 31) | ((0x3ff - 52 - e) << 20);
+	((int *)&s)[LOWORD] = 0;
+	t = (double)(int64_t)(a >> 11) * s;
+	u = (double)(int64_t)b * (s * twom43);
+	y[0] = t + u;
+	y[1] = (t - y[0]) + u;
+	return (n & 7);
+}
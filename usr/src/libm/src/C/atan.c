@@ -26,7 +26,9 @@
 
 #pragma ident	"@(#)atan.c	1.22	06/01/31 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak atan = __atan
+#endif
 
 /* INDENT OFF */
 /*
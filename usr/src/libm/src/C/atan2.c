@@ -25,7 +25,9 @@
 
 #pragma ident	"@(#)atan2.c	1.22	06/01/23 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak atan2 = __atan2
+#endif
 
 #include "libm.h"
 
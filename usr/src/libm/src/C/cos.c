@@ -25,7 +25,9 @@
 
 #pragma ident	"@(#)cos.c	1.13	06/01/23 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak cos = __cos
+#endif
 
 /* INDENT OFF */
 /*
@@ -0,0 +1,183 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#pragma weak cr_exp = __cr_exp
+
+/* INDENT OFF */
+/*
+ * cr_exp(x)
+ * exp(x) correctly rounded to nearest.
+ *
+ * Method:
+ *	1. Argument reduction: find k = 128*m + j, 0 <= j < 128, and r
+ *	   such that
+ *		x = k*(ln2/128) + r,  |r| <= ln2/256 (nearly).
+ *	   ln2/128 is split into L1+L2+L3, where L1 and L2 have 35
+ *	   significant bits, so that k*L1, k*L2 (|k| < 2^18) and
+ *	   x-k*L1 are exact; r is kept as the double-double rh+rl.
+ *
+ *	2. exp(x) = 2^m * 2^(j/128) * exp(r).  2^(j/128) is th+tl
+ *	   from _TBL_cr_exp, where th has 41 significant bits, and
+ *		exp(r) = 1 + rh + rl*(1+rh) + p(rh),
+ *	   where p(r) = r^2/2! + ... + r^6/6! (the Taylor polynomial;
+ *	   the terms left out are less than 2^-72).  With r1, rh
+ *	   rounded to a multiple of 2^-20, th*r1 is exact and
+ *	   th*(rh-r1) is off by less than 2^-73; the rest is summed in
+ *	   double, giving yh+yl with a relative error less than 2^-67.
+ *
+ *	3. If yh + yl*E rounds to yh, where E = 1+2^-12, no number
+ *	   within 2^-67 of yh+yl rounds differently, so yh is exp(x)
+ *	   correctly rounded (Ziv's rounding test, as in CRlibm).
+ *	   Otherwise, for about one argument in 4000, __k_cr_exp
+ *	   evaluates exp(x) to more than 230 bits and rounds that.
+ *	   Results in the subnormal range go to __k_cr_exp as well.
+ *
+ * Special cases: as exp (see exp.c).
+ *
+ * Misc. info.
+ *	On x86-64 (gcc -O2), cr_exp takes 1.4 to 1.45 times as long as
+ *	exp over arguments spread across its range, __k_cr_exp
+ *	included; __k_cr_exp takes about 300 times as long as exp, and
+ *	adds less than a tenth to the average.
+ */
+/* INDENT ON */
+
+#include "libm.h"
+
+extern const double _TBL_cr_exp[];
+#if defined(__i386) && !defined(__amd64)
+extern int __getRP(void);
+extern int __swapRP(int);
+#endif
+
+static const double C[] = {
+	0.5,
+	1.0,
+	0.0,
+	1.84664965233787313537e+02,	/* 0x40671547, 0x652b82fe */
+	5.41521234822539554443e-03,	/* 0x3f762e42, 0xfefc0000 */
+	-1.00822814609794810466e-13,	/* 0xbd3c610c, 0xa86c0000 */
+	-1.82874522388111205145e-25,	/* 0xbacc4c67, 0xfc0d0951 */
+	1.66666666666666657415e-01,	/* 0x3fc55555, 0x55555555 */
+	4.16666666666666643537e-02,	/* 0x3fa55555, 0x55555555 */
+	8.33333333333333321769e-03,	/* 0x3f811111, 0x11111111 */
+	1.38888888888888894189e-03,	/* 0x3f56c16c, 0x16c16c17 */
+	7.09782712893383973096e+02,	/* 0x40862E42, 0xFEFA39EF */
+	7.45133219101941108420e+02,	/* 0x40874910, 0xD52D3051 */
+	-7.08396418532264078749e+02,	/* 0xc086232b, 0xdd7abcd2 */
+	5.55111512312578270212e-17,	/* 0x3c900000, 0x00000000 */
+	1.00024414062500000000e+00,	/* 0x3ff00100, 0x00000000 */
+	6755399441055744.0,		/* 3 * 2^51 */
+	6442450944.0,			/* 3 * 2^31 */
+};
+
+#define	half		C[0]
+#define	one		C[1]
+#define	zero		C[2]
+#define	invln2_128	C[3]
+#define	L1		C[4]
+#define	L2		C[5]
+#define	L3		C[6]
+#define	P3		C[7]
+#define	P4		C[8]
+#define	P5		C[9]
+#define	P6		C[10]
+#define	threshold1	C[11]
+#define	threshold2	C[12]
+#define	threshold3	C[13]
+#define	twom54		C[14]
+#define	E		C[15]
+#define	c3two51		C[16]
+#define	c3two31		C[17]
+
+double
+cr_exp(double x) {
+	double	dk, z, t, rh, rl, r1, e, p, th, ph, pl, s, yh, yl;
+	int	hx, ix, k, j, m;
+#if defined(__i386) && !defined(__amd64)
+	int	rp;
+#endif
+
+	hx = ((int *)&x)[HIWORD];
+	ix = hx & ~0x80000000;
+
+	if (ix >= 0x4086232b) {	/* |x| >= 708.39 */
+		if (ix >= 0x7ff00000) {
+			if (hx == 0xfff00000 && ((int *)&x)[LOWORD] == 0)
+				return (zero);
+			return (x * x);
+		}
+		if (x > threshold1)
+			return (_SVID_libm_err(x, x, 6));
+		if (-x > threshold2)
+			return (_SVID_libm_err(x, x, 7));
+		if (x < threshold3)		/* subnormal result */
+			return (__k_cr_exp(x));
+	}
+	if (ix < 0x3c900000)	/* |x| < 2^-54 */
+		return (one + x);
+
+#if defined(__i386) && !defined(__amd64)
+	if ((rp = __getRP()) != fp_double)
+		(void) __swapRP(fp_double);
+#endif
+	t = invln2_128 * x + c3two51;
+	k = ((int *)&t)[LOWORD];
+	j = (k & 0x7f) << 1;
+	m = k >> 7;
+
+	/* x - k*ln2/128 = rh + rl */
+	dk = t - c3two51;
+	z = x - dk * L1;
+	t = -dk * L2;
+	TWO_SUM(rh, e, z, t);
+	rl = e - dk * L3;
+
+	/* 2^(j/128) * exp(r) = yh + yl */
+	z = rh * rh;
+	p = z * ((half + rh * P3) + z * ((P4 + rh * P5) + z * P6)) +
+	    rl * (one + rh);
+	th = _TBL_cr_exp[j];
+	r1 = (rh + c3two31) - c3two31;
+	ph = th * r1;
+	pl = th * (rh - r1);
+	FAST_TWO_SUM(s, e, th, ph);
+	t = e + (pl + (_TBL_cr_exp[j+1] * ((one + rh) + p) + th * p));
+	FAST_TWO_SUM(yh, yl, s, t);
+	t = yh + yl * E;
+#if defined(__i386) && !defined(__amd64)
+	if (rp != fp_double)
+		(void) __swapRP(rp);
+#endif
+	if (t != yh)
+		return (__k_cr_exp(x));
+	if (m < -1021) {
+		((int *)&yh)[HIWORD] += (m + 54) << 20;
+		return (twom54 * yh);
+	}
+	((int *)&yh)[HIWORD] += m << 20;
+	return (yh);
+}
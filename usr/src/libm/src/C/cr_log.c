@@ -0,0 +1,205 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#pragma weak cr_log = __cr_log
+
+/* INDENT OFF */
+/*
+ * cr_log(x)
+ * log(x) correctly rounded to nearest.
+ *
+ * Method:
+ *	1. For 1-2^-9 <= x < 1+2^-9, let r = x-1 (exact) and use (2)
+ *	   with n = 0 and log(c) = 0.  Otherwise write x = 2^n * m,
+ *	   1 <= m < 2, and let i be the leading 8 bits of the fraction
+ *	   of m.  With c = 1+(i+1/2)/256 and v, 1/c rounded to a multiple
+ *	   of 2^-9, both from _TBL_cr_log,
+ *		log(x) = n*ln2 + log(1/v) + log(1+r),  r = m*v-1,
+ *	   where |r| < 0.75*2^-8.  r is then a multiple of 2^-61 with
+ *	   at most 53 significant bits, and is computed exactly as
+ *	   rhi + rlo, rhi = mh*v-1 and rlo = ml*v, where mh is m with
+ *	   all but its leading 25 bits cleared.  rhi then has at most
+ *	   26 significant bits, so that r^2 = rhi^2 + rlo*(rhi+r) with
+ *	   rhi^2 exact.
+ *
+ *	2. log(1+r) = r - r^2/2 + r^3*q(r), q the Taylor polynomial of
+ *	   degree 6 (the terms left out are less than 2^-85 and, for
+ *	   x near 1, 2^-84*|r|).  n*ln2 and log(1/v) are double-doubles
+ *	   whose high parts are multiples of 2^-42, so that the sum of
+ *	   the high parts is exact.  The sum yh+yl has a relative error
+ *	   less than 2^-68.
+ *
+ *	3. If yh + yl*E rounds to yh, where E = 1+2^-13, yh is log(x)
+ *	   correctly rounded (see cr_exp.c).  Otherwise, for about
+ *	   one argument in 9000, __k_cr_log refines yh+yl by Newton's
+ *	   method to more than 180 bits and rounds that.
+ *
+ * Special cases: as log (see log.c).
+ *
+ * Misc. info.
+ *	On x86-64 (gcc -O2), cr_log takes about 1.75 times as long as
+ *	log over arguments spread across its range, __k_cr_log
+ *	included.
+ */
+/* INDENT ON */
+
+#include "libm.h"
+
+extern const double _TBL_cr_log[];
+#if defined(__i386) && !defined(__amd64)
+extern int __getRP(void);
+extern int __swapRP(int);
+#endif
+
+static const double C[] = {
+	0.5,
+	1.0,
+	0.0,
+	4503599627370496.0,
+	6.93147180559890330187e-01,	/* 0x3fe62e42, 0xfefa3800 */
+	5.49792301870837115524e-14,	/* 0x3d2ef357, 0x93c76730 */
+	3.33333333333333314830e-01,	/* 0x3fd55555, 0x55555555 */
+	-0.25,
+	2.00000000000000011102e-01,	/* 0x3fc99999, 0x9999999a */
+	-1.66666666666666657415e-01,	/* 0xbfc55555, 0x55555555 */
+	1.42857142857142849213e-01,	/* 0x3fc24924, 0x92492492 */
+	-0.125,
+	1.11111111111111104943e-01,	/* 0x3fbc71c7, 0x1c71c71c */
+	1.00012207031250000000e+00,	/* 0x3ff00080, 0x00000000 */
+};
+
+#define	half	C[0]
+#define	one	C[1]
+#define	zero	C[2]
+#define	two52	C[3]
+#define	LN2H	C[4]
+#define	LN2L	C[5]
+#define	Q0	C[6]
+#define	Q1	C[7]
+#define	Q2	C[8]
+#define	Q3	C[9]
+#define	Q4	C[10]
+#define	Q5	C[11]
+#define	Q6	C[12]
+#define	E	C[13]
+
+double
+cr_log(double x) {
+	double	*tb, dn, m, mh, ml, z, rh, rhi, rlo, zh, zl, s, e, t, h, hi, lo,
+		yh, yl;
+	int	i, hx, ix, lx, n;
+#if defined(__i386) && !defined(__amd64)
+	int	rp;
+#endif
+
+	n = 0;
+	hx = ((int *)&x)[HIWORD];
+	ix = hx & 0x7fffffff;
+	lx = ((int *)&x)[LOWORD];
+
+	/* subnormal,0,negative,inf,nan */
+	if ((hx + 0x100000) < 0x200000) {
+		if (ix > 0x7ff00000 || (ix == 0x7ff00000 && lx != 0)) /* nan */
+			return (x * x);
+		if (((hx << 1) | lx) == 0)		/* zero */
+			return (_SVID_libm_err(x, x, 16));
+		if (hx < 0)				/* negative */
+			return (_SVID_libm_err(x, x, 17));
+		if (((hx - 0x7ff00000) | lx) == 0)	/* +inf */
+			return (x);
+
+		/* x must be positive and subnormal */
+		x *= two52;
+		n = -52;
+		hx = ((int *)&x)[HIWORD];
+	}
+
+#if defined(__i386) && !defined(__amd64)
+	if ((rp = __getRP()) != fp_double)
+		(void) __swapRP(fp_double);
+#endif
+	if (hx >= 0x3feff000 && hx < 0x3ff00800) {
+		/* 1-2^-9 <= x < 1+2^-9 */
+		if (((hx - 0x3ff00000) | lx) == 0) {	/* x = 1 */
+			yh = yl = zero;
+			goto done;
+		}
+		rh = x - one;
+		TWO_PROD(zh, zl, rh, rh);
+		zh *= -half;
+		zl *= -half;
+		FAST_TWO_SUM(s, e, rh, zh);
+		z = rh * rh;
+		t = e + (zl + (z * rh) * (((Q0 + rh * Q1) + z * (Q2 +
+		    rh * Q3)) + (z * z) * ((Q4 + rh * Q5) + z * Q6)));
+		FAST_TWO_SUM(yh, yl, s, t);
+	} else {
+		dn = (double)(n + ((hx >> 20) - 0x3ff));
+		i = (hx >> 12) & 0xff;
+		m = x;
+		((int *)&m)[HIWORD] = (hx & 0x000fffff) | 0x3ff00000;
+		tb = (double *)_TBL_cr_log + (i + i + i);
+
+		/*
+		 * r = m*v-1 = rh exactly, and r^2 = rhi^2 + rlo*(rhi+rh)
+		 * with rhi^2 exact
+		 */
+		mh = m;
+		((int *)&mh)[LOWORD] &= 0xf0000000;
+		ml = m - mh;
+		rhi = mh * tb[0] - one;
+		rlo = ml * tb[0];
+		rh = rhi + rlo;
+
+		/* log(1+r) = s+t */
+		zh = -half * (rhi * rhi);
+		zl = -half * (rlo * (rhi + rh));
+		FAST_TWO_SUM(s, e, rh, zh);
+		z = rh * rh;
+		t = e + (zl + (z * rh) * (((Q0 + rh * Q1) + z * (Q2 +
+		    rh * Q3)) + (z * z) * ((Q4 + rh * Q5) + z * Q6)));
+
+		/* add n*ln2 + log(1/v); the first sum is exact */
+		hi = dn * LN2H + tb[1];
+		TWO_SUM(h, z, hi, s);
+		lo = (t + z) + (tb[2] + dn * LN2L);
+		FAST_TWO_SUM(yh, yl, h, lo);
+	}
+	t = yh + yl * E;
+	if (t != yh) {
+#if defined(__i386) && !defined(__amd64)
+		if (rp != fp_double)
+			(void) __swapRP(rp);
+#endif
+		return (__k_cr_log(x, n, yh, yl));
+	}
+done:
+#if defined(__i386) && !defined(__amd64)
+	if (rp != fp_double)
+		(void) __swapRP(rp);
+#endif
+	return (yh);
+}
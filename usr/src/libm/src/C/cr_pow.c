@@ -0,0 +1,320 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#pragma weak cr_pow = __cr_pow
+
+/* INDENT OFF */
+/*
+ * cr_pow(x,y)
+ * x**y correctly rounded to nearest.
+ *
+ * Method:
+ *	1. log|x| = lh+ll, with a relative error less than 2^-78, as in
+ *	   cr_log.c but with r^3/3 formed in double-double as well and
+ *	   the series taken to r^10 (see log_x below).
+ *
+ *	2. y*log|x| = th+tl, with y*lh formed exactly.  Its error is
+ *	   at most |th|*2^-78 < 2^-68.
+ *
+ *	3. exp(th+tl) = yh+yl as in cr_exp.c, with tl folded into the
+ *	   reduced argument; yh+yl has a relative error less than 2^-66.
+ *	   yh is the result if yh + yl*E rounds to yh, E = 1+2^-12.
+ *	   Otherwise, for about one argument in 4000, __k_cr_pow
+ *	   recomputes x**y to more than 170 bits and rounds that.
+ *	   Results that may overflow or be subnormal also go to
+ *	   __k_cr_pow.
+ *
+ *	   Unlike exp and log, x**y can be exactly halfway between two
+ *	   doubles (e.g. 10**23).  __k_cr_pow takes a value that agrees
+ *	   with a halfway point to 160 bits to be that point, and rounds
+ *	   it to even.
+ *
+ * Special cases:
+ *	y = 0, +-1, 2 or 1/2, x or y inf or nan, x = 0 or +-1, and
+ *	x < 0 with y not an integer are handled by pow (see pow.c),
+ *	whose results for these are exact or correctly rounded.
+ *	|y| >= 2^63 always overflows or underflows and is likewise
+ *	passed to pow.
+ *
+ * Misc. info.
+ *	On x86-64 (gcc -O2), cr_pow takes about 1.5 times as long as
+ *	pow for x within e^+-20 and |y| < 15, __k_cr_pow included.
+ */
+/* INDENT ON */
+
+#include "libm.h"
+
+extern const double _TBL_cr_exp[], _TBL_cr_log[];
+#if defined(__i386) && !defined(__amd64)
+extern int __getRP(void);
+extern int __swapRP(int);
+#endif
+
+static const double C[] = {
+	0.5,
+	1.0,
+	0.0,
+	4503599627370496.0,
+	6.93147180559890330187e-01,	/* 0x3fe62e42, 0xfefa3800 */
+	5.49792301870837115524e-14,	/* 0x3d2ef357, 0x93c76730 */
+	3.33333333333333314830e-01,	/* 0x3fd55555, 0x55555555 */
+	1.85037170770859413132e-17,	/* 0x3c755555, 0x55555555 */
+	-0.25,
+	2.00000000000000011102e-01,	/* 0x3fc99999, 0x9999999a */
+	-1.66666666666666657415e-01,	/* 0xbfc55555, 0x55555555 */
+	1.42857142857142849213e-01,	/* 0x3fc24924, 0x92492492 */
+	-0.125,
+	1.11111111111111104943e-01,	/* 0x3fbc71c7, 0x1c71c71c */
+	-1.00000000000000005551e-01,	/* 0xbfb99999, 0x9999999a */
+	1.84664965233787313537e+02,	/* 0x40671547, 0x652b82fe */
+	5.41521234822539554443e-03,	/* 0x3f762e42, 0xfefc0000 */
+	-1.00822814609794810466e-13,	/* 0xbd3c610c, 0xa86c0000 */
+	-1.82874522388111205145e-25,	/* 0xbacc4c67, 0xfc0d0951 */
+	1.66666666666666657415e-01,	/* 0x3fc55555, 0x55555555 */
+	4.16666666666666643537e-02,	/* 0x3fa55555, 0x55555555 */
+	8.33333333333333321769e-03,	/* 0x3f811111, 0x11111111 */
+	1.38888888888888894189e-03,	/* 0x3f56c16c, 0x16c16c17 */
+	709.8,
+	-745.2,
+	7.09782712893383973096e+02,	/* 0x40862E42, 0xFEFA39EF */
+	-7.08396418532264078749e+02,	/* 0xc086232b, 0xdd7abcd2 */
+	2.77555756156289135106e-17,	/* 0x3c800000, 0x00000000 */
+	5.55111512312578270212e-17,	/* 0x3c900000, 0x00000000 */
+	1.00024414062500000000e+00,	/* 0x3ff00100, 0x00000000 */
+	6755399441055744.0,		/* 3 * 2^51 */
+	6442450944.0,			/* 3 * 2^31 */
+};
+
+#define	half		C[0]
+#define	one		C[1]
+#define	zero		C[2]
+#define	two52		C[3]
+#define	LN2H		C[4]
+#define	LN2L		C[5]
+#define	third		C[6]
+#define	third_lo	C[7]
+#define	Q0		C[8]
+#define	Q1		C[9]
+#define	Q2		C[10]
+#define	Q3		C[11]
+#define	Q4		C[12]
+#define	Q5		C[13]
+#define	Q6		C[14]
+#define	invln2_128	C[15]
+#define	L1		C[16]
+#define	L2		C[17]
+#define	L3		C[18]
+#define	P3		C[19]
+#define	P4		C[20]
+#define	P5		C[21]
+#define	P6		C[22]
+#define	othresh		C[23]
+#define	uthresh		C[24]
+#define	threshold1	C[25]
+#define	threshold3	C[26]
+#define	twom55		C[27]
+#define	twom54		C[28]
+#define	E		C[29]
+#define	c3two51		C[30]
+#define	c3two31		C[31]
+
+/*
+ * Return log(x) = (return value) + *w for finite x > 0, x != 1; the
+ * two parts are normalized (see step 1 above).
+ */
+static double
+log_x(double x, double *w) {
+	double	*tb, dn, m, mh, ml, z, rh, zh, zl, ch, cl, dh, dl, s, e, s2,
+		e2, t, hi, lo;
+	int	i, hx, n;
+
+	n = 0;
+	hx = ((int *)&x)[HIWORD];
+	if (hx < 0x00100000) {		/* subnormal x */
+		x *= two52;
+		n = -52;
+		hx = ((int *)&x)[HIWORD];
+	}
+	i = -1;
+	if (hx >= 0x3feff000 && hx < 0x3ff00800) {
+		/* 1-2^-9 <= x < 1+2^-9 */
+		rh = x - one;
+	} else {
+		dn = (double)(n + ((hx >> 20) - 0x3ff));
+		i = (hx >> 12) & 0xff;
+		m = x;
+		((int *)&m)[HIWORD] = (hx & 0x000fffff) | 0x3ff00000;
+		tb = (double *)_TBL_cr_log + (i + i + i);
+		mh = m;
+		((int *)&mh)[LOWORD] &= 0xfffffc00;
+		ml = m - mh;
+		rh = (mh * tb[0] - one) + ml * tb[0];
+	}
+
+	/* r^2/2 = zh+zl and r^3/3 = dh+dl */
+	TWO_PROD(zh, zl, rh, rh);
+	TWO_PROD(ch, cl, zh, rh);
+	cl += zl * rh;
+	TWO_PROD(dh, dl, ch, third);
+	dl += cl * third + ch * third_lo;
+	zh *= -half;
+	zl *= -half;
+
+	/* log(1+r) = s2 + lo */
+	FAST_TWO_SUM(s, e, rh, zh);
+	FAST_TWO_SUM(s2, e2, s, dh);
+	z = rh * rh;
+	t = z * z;
+	lo = (e + e2) + ((zl + dl) + t * (((Q0 + rh * Q1) + z * (Q2 +
+	    rh * Q3)) + t * ((Q4 + rh * Q5) + z * Q6)));
+	if (i < 0) {
+		FAST_TWO_SUM(hi, *w, s2, lo);
+		return (hi);
+	}
+
+	/* add n*ln2 + log(1/v); the first sum is exact */
+	hi = dn * LN2H + tb[1];
+	TWO_SUM(s, z, hi, s2);
+	lo = (lo + z) + (tb[2] + dn * LN2L);
+	FAST_TWO_SUM(hi, *w, s, lo);
+	return (hi);
+}
+
+double
+cr_pow(double x, double y) {
+	double	ax, lh, ll, dk, z, t, th, tl, rh, rl, e, p, ph, pl, s, yh,
+		yl;
+	int	hx, hy, ahx, ahy, sbx, yisint, j, k, m;
+	unsigned lx, ly;
+#if defined(__i386) && !defined(__amd64)
+	int	rp;
+#endif
+
+	hx = ((int *)&x)[HIWORD];
+	lx = ((unsigned *)&x)[LOWORD];
+	hy = ((int *)&y)[HIWORD];
+	ly = ((unsigned *)&y)[LOWORD];
+	ahx = hx & ~0x80000000;
+	ahy = hy & ~0x80000000;
+
+	/* special cases: see pow.c */
+	if ((ahy | ly) == 0 || ahy >= 0x43e00000 || ahx >= 0x7ff00000 ||
+	    (ahx | lx) == 0 || ((ahx - 0x3ff00000) | lx) == 0 ||
+	    (ly == 0 && (ahy == 0x3ff00000 || hy == 0x40000000 ||
+	    hy == 0x3fe00000)))
+		return (pow(x, y));
+
+	/* as in pow.c, yisint = 0 (not an integer), 1 (odd) or 2 (even) */
+	sbx = (unsigned)hx >> 31;
+	yisint = 0;
+	if (sbx) {
+		if (ahy >= 0x43400000)
+			yisint = 2;		/* even integer y */
+		else if (ahy >= 0x3ff00000) {
+			k = (ahy >> 20) - 0x3ff;	/* exponent */
+			if (k > 20) {
+				j = ly >> (52 - k);
+				if ((j << (52 - k)) == ly)
+					yisint = 2 - (j & 1);
+			} else if (ly == 0) {
+				j = ahy >> (20 - k);
+				if ((j << (20 - k)) == ahy)
+					yisint = 2 - (j & 1);
+			}
+		}
+		if (yisint == 0)
+			return (pow(x, y));
+	}
+	ax = fabs(x);
+
+#if defined(__i386) && !defined(__amd64)
+	if ((rp = __getRP()) != fp_double)
+		(void) __swapRP(fp_double);
+#endif
+	lh = log_x(ax, &ll);
+	th = y * lh;
+	if (th > othresh || th < uthresh) {
+#if defined(__i386) && !defined(__amd64)
+		if (rp != fp_double)
+			(void) __swapRP(rp);
+#endif
+		return (_SVID_libm_err(x, y, th > zero ? 21 : 22));
+	}
+	if (fabs(th) < twom55) {
+		z = one + th;
+		goto done;
+	}
+	if (th > threshold1 || th < threshold3)
+		goto slow;
+
+	/* y*log|x| = th+tl */
+	TWO_PROD(th, tl, y, lh);
+	tl += y * ll;
+
+	/* exp(th+tl), as in cr_exp.c */
+	t = invln2_128 * th + c3two51;
+	k = ((int *)&t)[LOWORD];
+	j = (k & 0x7f) << 1;
+	m = k >> 7;
+	dk = t - c3two51;
+	z = th - dk * L1;
+	t = -dk * L2;
+	TWO_SUM(rh, e, z, t);
+	rl = (e - dk * L3) + tl;
+	z = rh * rh;
+	p = z * ((half + rh * P3) + z * ((P4 + rh * P5) + z * P6)) +
+	    rl * (one + rh + half * z);
+	t = _TBL_cr_exp[j];
+	z = (rh + c3two31) - c3two31;
+	ph = t * z;
+	pl = t * (rh - z);
+	FAST_TWO_SUM(s, e, t, ph);
+	z = e + (pl + (_TBL_cr_exp[j+1] * ((one + rh) + p) + t * p));
+	FAST_TWO_SUM(yh, yl, s, z);
+	z = yh + yl * E;
+	if (z != yh)
+		goto slow;
+	if (m < -1021) {
+		((int *)&yh)[HIWORD] += (m + 54) << 20;
+		z = twom54 * yh;
+	} else {
+		((int *)&yh)[HIWORD] += m << 20;
+		z = yh;
+	}
+done:
+#if defined(__i386) && !defined(__amd64)
+	if (rp != fp_double)
+		(void) __swapRP(rp);
+#endif
+	return ((yisint == 1) ? -z : z);
+
+slow:
+#if defined(__i386) && !defined(__amd64)
+	if (rp != fp_double)
+		(void) __swapRP(rp);
+#endif
+	return (__k_cr_pow(x, y, lh, ll, yisint == 1));
+}
@@ -25,7 +25,9 @@
 
 #pragma ident	"@(#)exp.c	1.25	06/01/24 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak exp = __exp
+#endif
 
 /*
  * exp(x)
@@ -300,11 +302,11 @@ exp(double x) {
 #endif
 				if (hx < 0x3e300000)
 					return (one + x);
-				return (one + x * (one + half * x));
+				return (FMADD(x, FMADD(half, x, one), one));
 			}
 			t = x * x;
-			y = x + (t * (half + x * t2) +
-			    (t * t) * (t3 + x * t4 + t * t5));
+			y = x + FMADD(t * t, FMADD(t, t5, FMADD(x, t4, t3)),
+			    t * FMADD(x, t2, half));
 			return (one + y);
 		}
 
@@ -316,9 +318,9 @@ exp(double x) {
 			j += 134;
 		z = x - TBL2[j];
 		t = z * z;
-		y = z + (t * (half + z * t2) +
-		    (t * t) * (t3 + z * t4 + t * t5));
-		return (TBL2[j+1] + TBL2[j+1] * y);
+		y = z + FMADD(t * t, FMADD(t, t5, FMADD(z, t4, t3)),
+		    t * FMADD(z, t2, half));
+		return (FMADD(TBL2[j+1], y, TBL2[j+1]));
 	}
 
 	if (hx >= 0x40862e42) {	/* x is large, infinite, or nan */
@@ -341,12 +343,13 @@ exp(double x) {
 	k = (int)t;
 	j = (k & 0x1f) << 1;
 	m = k >> 5;
-	z = (x - k * ln2_32hi) - k * ln2_32lo;
+	z = FMADD(-k, ln2_32lo, x - k * ln2_32hi);
 
 	/* z is now in primary range */
 	t = z * z;
-	y = z + (t * (half + z * t2) + (t * t) * (t3 + z * t4 + t * t5));
-	y = TBL[j] + (TBL[j+1] + TBL[j] * y);
+	y = z + FMADD(t * t, FMADD(t, t5, FMADD(z, t4, t3)),
+	    t * FMADD(z, t2, half));
+	y = TBL[j] + FMADD(TBL[j], y, TBL[j+1]);
 	if (m < -1021) {
 		((int *)&y)[HIWORD] += (m + 54) << 20;
 		return (twom54 * y);
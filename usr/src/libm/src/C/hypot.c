@@ -27,8 +27,10 @@
 #pragma ident	"@(#)hypot.c	1.31	06/01/31 SMI"
 
 #if defined(ELFOBJ)
+#if !defined(LIBM_ISA_BODY)
 #pragma weak hypot = __hypot
 #endif
+#endif
 
 /* INDENT OFF */
 /*
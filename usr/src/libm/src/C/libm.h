@@ -147,10 +147,18 @@ sym	= __/**/sym
 
 #elif defined(__i386) || defined(__amd64)
 
+/*
+ * An x87 body that __libm_ifunc.c chooses between at load time
+ * must not bind the public name itself.
+ */
+#if defined(LIBM_ISA_BODY)
+#define	LIBM_ANSI_PRAGMA_WEAK(sym,stype)
+#else
 #define	LIBM_ANSI_PRAGMA_WEAK(sym,stype) \
 	.weak sym; \
 	.type sym,@stype; \
 sym	= __/**/sym
+#endif
 
 #ifdef PIC
 #if defined(__amd64)
@@ -73,4 +73,50 @@
 #error Unknown architecture
 #endif
 
+/*
+ * FMADD(a, b, c) is a * b + c.  In the bodies built for processors
+ * with fused multiply-add (LIBM_FMA_BODY; see __libm_ifunc.c) it is
+ * rounded once; elsewhere it is exactly the unfused expression, so
+ * that those builds compute what they always have.  gcc turns
+ * __builtin_fma into a single vfmadd on the operands' registers
+ * (the _mm_fmadd_sd intrinsics cost a register move per operand);
+ * the Studio compilers contract the plain expression when given
+ * -fma=fused, as the Makefiles do for these bodies.
+ */
+#if defined(LIBM_FMA_BODY) && defined(__GNUC__)
+#define	FMADD(a, b, c)	__builtin_fma(a, b, c)
+#else
+#define	FMADD(a, b, c)	((a) * (b) + (c))
+#endif
+
+/*
+ * Error-free transformations, for the double-double arithmetic of
+ * cr_exp.c, cr_log.c and cr_pow.c.  They assume rounding to nearest
+ * in double precision (on i386 the callers set the x87 rounding
+ * precision to double), and the arguments must be variables.
+ *
+ * FAST_TWO_SUM(s, e, a, b) sets s = a + b rounded and e = a + b - s
+ * exactly, provided |a| >= |b| or a = 0.  TWO_SUM does the same for
+ * any a and b.  TWO_PROD(p, e, a, b) sets p = a * b rounded and
+ * e = a * b - p exactly, provided |a|, |b| < 2^996 and no partial
+ * product underflows (Dekker's algorithm).
+ */
+#define	FAST_TWO_SUM(s, e, a, b) \
+	{ s = a + b; e = b - (s - a); }
+
+#define	TWO_SUM(s, e, a, b) \
+	{ double _v; s = a + b; _v = s - a; e = (a - (s - _v)) + (b - _v); }
+
+#define	SPLIT(h, l, a) \
+	{ double _c; _c = 134217729.0 * a; h = _c - (_c - a); l = a - h; }
+
+#define	TWO_PROD(p, e, a, b) \
+	{ \
+		double _ah, _al, _bh, _bl; \
+		SPLIT(_ah, _al, a); \
+		SPLIT(_bh, _bl, b); \
+		p = a * b; \
+		e = ((_ah * _bh - p) + _ah * _bl + _al * _bh) + _al * _bl; \
+	}
+
 #endif	/* !defined(_LIBM_MACROS_H) */
@@ -48,6 +48,7 @@
 #define	__k_sincos_	__libmopt__k_sincos_
 #define	__reduction	__libmopt__reduction
 #define	__rem_pio2	__libmopt__rem_pio2
+#define	__rem_pio2i	__libmopt__rem_pio2i
 #define	__rem_pio2m	__libmopt__rem_pio2m
 #else	/* defined(LIBMOPT_BUILD) */
 #ifdef LIBM_BUILD
@@ -56,6 +57,8 @@
 #define	_TBL_atan1	__libm_TBL_atan1
 #define	_TBL_atan_hi	__libm_TBL_atan_hi	/* not used by -lsunmath */
 #define	_TBL_atan_lo	__libm_TBL_atan_lo	/* not used by -lsunmath */
+#define	_TBL_cr_exp	__libm_TBL_cr_exp
+#define	_TBL_cr_log	__libm_TBL_cr_log
 #define	_TBL_exp2_hi	__libm_TBL_exp2_hi	/* not used by -lsunmath */
 #define	_TBL_exp2_lo	__libm_TBL_exp2_lo	/* not used by -lsunmath */
 #define	_TBL_ipio2_inf	__libm_TBL_ipio2_inf
@@ -75,12 +78,17 @@
 #define	__k_atan2	__libm__k_atan2		/* C99 libm */
 #define	__k_atan2l	__libm__k_atan2l	/* C99 libm */
 #define	__k_cos		__libm__k_cos
+#define	__k_cr_exp	__libm__k_cr_exp
+#define	__k_cr_log	__libm__k_cr_log
+#define	__k_cr_pow	__libm__k_cr_pow
 #define	__k_lgamma	__libm__k_lgamma
 #define	__k_sin		__libm__k_sin
 #define	__k_sincos	__libm__k_sincos
 #define	__k_tan		__libm__k_tan
 #define	__reduction	__libm__reduction	/* i386 only */
 #define	__rem_pio2	__libm__rem_pio2
+#define	__rem_pio2f	__libm__rem_pio2f
+#define	__rem_pio2i	__libm__rem_pio2i
 #define	__rem_pio2m	__libm__rem_pio2m
 #define	__k_cosf	__libm__k_cosf		/* C99 libm */
 #define	__k_cosl	__libm__k_cosl		/* C99 libm */
@@ -125,6 +133,9 @@
 extern double _SVID_libm_err __P((double, double, int));
 extern double __k_cos __P((double, double));
 extern double __k_cos_ __P((double *));
+extern double __k_cr_exp __P((double));
+extern double __k_cr_log __P((double, int, double, double));
+extern double __k_cr_pow __P((double, double, double, double, int));
 extern double __k_lgamma __P((double, int *));
 extern double __k_sin __P((double, double));
 extern double __k_sin_ __P((double *));
@@ -139,6 +150,8 @@ extern double __k_atan2 __P((double, double, double *));
 extern long double __k_atan2l __P((long double, long double, long double *));
 extern int __rem_pio2 __P((double, double *));
 extern int __rem_pio2m __P((double *, double *, int, int, int, const int *));
+extern int __rem_pio2f __P((float, double *));
+extern int __rem_pio2i __P((double, double *));
 
 /*
  * entry points that are in-lined
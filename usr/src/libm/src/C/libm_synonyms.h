@@ -190,6 +190,9 @@
 #define	cospif			__cospif
 #define	cospil			__cospil
 #define	cospl			__cospl
+#define	cr_exp			__cr_exp
+#define	cr_log			__cr_log
+#define	cr_pow			__cr_pow
 #define	d_acos_			__d_acos_
 #define	d_acosd_		__d_acosd_
 #define	d_acosh_		__d_acosh_
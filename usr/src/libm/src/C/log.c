@@ -25,7 +25,9 @@
 
 #pragma ident	"@(#)log.c	1.29	06/01/23 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak log = __log
+#endif
 
 /* INDENT OFF */
 /*
@@ -191,17 +193,17 @@ log(double x) {
 				return (z);
 			r = (A10 * s) * (A11 + s);
 			w = z * s;
-			return (s + ((A1 * z) *
-				(A2 + ((A3 * s) * (A4 + s) + w * (A5 + s)))) *
-				((A6 + (s * (A7 + s) + w * (A8 + s))) *
-				(A9 + (r + w * (A12 + s)))));
+			return (FMADD((A1 * z) *
+				(A2 + FMADD(w, A5 + s, (A3 * s) * (A4 + s))),
+				(A6 + FMADD(w, A8 + s, s * (A7 + s))) *
+				(A9 + FMADD(w, A12 + s, r)), s));
 		} else {
 			i = (ix - 0x3fb80000) >> 15;
 			tb = (double *)_TBL_log + (i + i + i);
 			s = (x - tb[0]) * tb[1];
-			return (tb[2] +  ((B1 * s) * (B2 + s * (B3 + s))) *
-				(((B4 + s * B5) + (s * s) * (B6 + s)) *
-				(B7 + s * (B8 + s))));
+			return (FMADD((B1 * s) * FMADD(s, B3 + s, B2),
+				FMADD(s * s, B6 + s, FMADD(s, B5, B4)) *
+				FMADD(s, B8 + s, B7), tb[2]));
 		}
 	} else {
 		dn = (double)(n + ((ix >> 20) - 0x3ff));
@@ -211,9 +213,9 @@ log(double x) {
 		i = (i - 0x3fb80000) >> 15;
 		tb = (double *)_TBL_log + (i + i + i);
 		s = (x - tb[0]) * tb[1];
-		dn = dn * LN2LO + tb[2];
-		return (dn1 + (dn + ((B1 * s) * (B2 + s * (B3 + s))) *
-			(((B4 + s * B5) + (s * s) * (B6 + s)) *
-			(B7 + s * (B8 + s)))));
+		dn = FMADD(dn, LN2LO, tb[2]);
+		return (dn1 + FMADD((B1 * s) * FMADD(s, B3 + s, B2),
+			FMADD(s * s, B6 + s, FMADD(s, B5, B4)) *
+			FMADD(s, B8 + s, B7), dn));
 	}
 }
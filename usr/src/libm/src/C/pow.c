@@ -27,8 +27,10 @@
 #pragma ident	"@(#)pow.c	1.44	06/01/31 SMI"
 
 #if defined(ELFOBJ)
+#if !defined(LIBM_ISA_BODY)
 #pragma weak pow = __pow
 #endif
+#endif
 
 /*
  * pow(x,y) return x**y
@@ -111,10 +113,11 @@ log2_x(double x, double *w) {
 		v = s * s;
 		h = (double) ((float) s);
 		f1 = (double) ((float) f);
-		t = qn * (((f - two * h) - h * f1) - h * (f - f1));
+		t = qn * FMADD(-h, f - f1, FMADD(-h, f1, f - two * h));
 								/* s = h+t */
-		f1 = h * B0_lo + s * (v * (B1 + v * (B2 + v * (B3 + v * B4))));
-		t = f1 + t * B0;
+		f1 = FMADD(s, v * FMADD(v, FMADD(v, FMADD(v, B4, B3), B2), B1),
+		    h * B0_lo);
+		t = FMADD(t, B0, f1);
 		h *= B0_hi;
 		s = (double) ((float) (h + t));
 		*w = t - (s - h);
@@ -136,11 +139,11 @@ log2_x(double x, double *w) {
 	f = x - z;
 	s = f * qn;
 	h = (double) ((float) s);
-	t = qn * ((f - (h + h) * z) - h * f);
+	t = qn * FMADD(-h, f, FMADD(-(h + h), z, f));
 	j = (i >> 13) & 0x7f;
 	f = s * s;
-	t = t * A1 + h * A1_lo;
-	t += (s * f) * (A2 + f * A3);
+	t = FMADD(t, A1, h * A1_lo);
+	t = FMADD(s * f, FMADD(f, A3, A2), t);
 	qn = h * A1_hi;
 	s = n + _TBL_log2_hi[j];
 	h = qn + s;
@@ -294,9 +297,15 @@ pow(double x, double y) {
 		y1 = y * w1;
 		y2 = y * w2;
 	} else {
+#if defined(LIBM_FMA_BODY)
+		/* y*w1-y1 is exact, so y need not be split */
+		y1 = y * w1;
+		y2 = FMADD(y, w1, -y1) + y * w2;
+#else
 		y1 = (double) ((float) y);
 		y2 = (y - y1) * w1 + y * w2;
 		y1 *= w1;
+#endif
 	}
 	z = y1 + y2;
 	j = pz[HIWORD];
@@ -328,8 +337,8 @@ pow(double x, double y) {
 	j = k & 63;
 	w1 = y2 - ((double) k * 0.015625 - y1);
 	w2 = _TBL_exp2_hi[j];
-	z = _TBL_exp2_lo[j] + (w2 * w1) * (E1 + w1 * (E2 + w1 * (E3 + w1 *
-		(E4 + w1 * E5))));
+	z = FMADD(w2 * w1, FMADD(w1, FMADD(w1, FMADD(w1, FMADD(w1, E5, E4),
+		E3), E2), E1), _TBL_exp2_lo[j]);
 	z += w2;
 	k >>= 6;
 	if (k < -1021)
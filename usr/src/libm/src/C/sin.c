@@ -25,7 +25,9 @@
 
 #pragma ident	"@(#)sin.c	1.12	06/01/23 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak sin = __sin
+#endif
 
 /* INDENT OFF */
 /*
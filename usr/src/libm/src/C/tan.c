@@ -26,7 +26,9 @@
 
 #pragma ident	"@(#)tan.c	1.17	06/01/31 SMI"
 
+#if !defined(LIBM_ISA_BODY)
 #pragma weak tan = __tan
+#endif
 
 /* INDENT OFF */
 /*
@@ -0,0 +1,113 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __rem_pio2f(x, y) passes back y = |x| - n*pi/2 with |y| <= pi/4
+ * to nearly double precision and returns n mod 8, for finite float
+ * x with |x| >= 2^19.  The sign of x is ignored; the caller applies
+ * it to n and y.
+ *
+ * This is __rem_pio2i cut down to a 24-bit significand: write
+ * |x| = m * 2^(k - 23) with m a 24-bit integer.  Bits of 2/pi more
+ * than k - 26 places right of the binary point contribute multiples
+ * of 8 to |x| * 2/pi, so we take the 128 bits that follow them and
+ * multiply them by m with four 32x32->64-bit products, keeping the
+ * low 128 bits.  The top three are n mod 8 and the rest are the
+ * fraction, accurate to about 2^-101; the fraction of a float is
+ * never closer than about 2^-30 to an integer.
+ *
+ * The top 64 bits of the fraction, taken as a signed integer, round
+ * the product to the nearest integer for free, and they and the 61
+ * bits below them are converted to double and scaled by pi/2.
+ */
+
+#include "libm.h"
+#include <sys/types.h>
+
+/*
+ * 2/pi in 32-bit words, preceded by three words of zeroes; |x| <
+ * 2^128 needs no more than this
+ */
+static const unsigned ipio2w[] = {
+	0x00000000, 0x00000000, 0x00000000,
+	0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041,
+	0xfe5163ab, 0xdebbc561,
+};
+
+static const double
+	twom61	= 4.33680868994201773603e-19,
+	pio2_64	= 8.51530395021638614140e-20;	/* 2^-64 * 1.921FB54442D18 */
+
+int
+__rem_pio2f(float x, double *y) {
+	uint64_t	t, hi, lo;
+	unsigned	w0, w1, w2, w3, p0, p1, p2, m;
+	int		ix, e, i, j, n;
+
+	/* |x| = m * 2^(e - 23) */
+	ix = *((int *)&x) & 0x7fffffff;
+	e = (ix >> 23) - 0x7f;
+	m = (ix & 0x7fffff) | 0x800000;
+
+	/*
+	 * w0:w1:w2:w3 = the 128 bits of 2/pi starting e - 25 places
+	 * right of the binary point
+	 */
+	i = e + 70;
+	j = i & 31;
+	i >>= 5;
+	t = ((((uint64_t)ipio2w[i] << 32) | ipio2w[i+1]) << j) |
+	    ((uint64_t)ipio2w[i+2] >> (32 - j));
+	w0 = (unsigned)(t >> 32);
+	w1 = (unsigned)t;
+	t = ((((uint64_t)ipio2w[i+2] << 32) | ipio2w[i+3]) << j) |
+	    ((uint64_t)ipio2w[i+4] >> (32 - j));
+	w2 = (unsigned)(t >> 32);
+	w3 = (unsigned)t;
+
+	/*
+	 * p0:p1:p2:(low word of t) = the low 128 bits of m * w0:w1:w2:w3,
+	 * so that |x| * 2/pi = p * 2^-125 mod 8
+	 */
+	t = (uint64_t)m * w3;
+	lo = t & 0xffffffff;
+	t = (uint64_t)m * w2 + (t >> 32);
+	p2 = (unsigned)t;
+	t = (uint64_t)m * w1 + (t >> 32);
+	p1 = (unsigned)t;
+	p0 = m * w0 + (unsigned)(t >> 32);
+
+	/*
+	 * hi = the top 64 bits of the fraction; if the fraction is 1/2
+	 * or more, hi is negative and n is one more
+	 */
+	hi = ((uint64_t)p0 << 35) | ((uint64_t)p1 << 3) | (p2 >> 29);
+	lo |= (uint64_t)(p2 & 0x1fffffff) << 32;
+	n = (int)(p0 >> 29) + (int)(hi >> 63);
+	*y = ((double)(int64_t)hi + (double)(int64_t)lo * twom61) * pio2_64;
+	return (n & 7);
+}
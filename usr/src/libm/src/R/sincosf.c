@@ -50,16 +50,21 @@
  *	C4 =  -3.63151270591815439197122504991683846785293207730e+0001
  *
  * with error bounded by |cos(x) - C(x)| < 2**(-34.2).
+ *
+ * For 3*pi/4 <= |x| < 2^19*pi, let n be the integer nearest x*2/pi
+ * and reduce x to y = (x - n*pio2_1) - n*pio2_t, where pio2_1 is the
+ * first 33 bits of pi/2.  n*pio2_1 and x - n*pio2_1 are exact in
+ * double as well as extended precision, so on x87 the reduction runs
+ * in whatever precision is current.  n is read from the low word of
+ * x*2/pi + 1.5*2^52, which is rounded to an integer when it is stored
+ * as a double, since a conversion to int would change the x87
+ * rounding direction.  Larger arguments are reduced by __rem_pio2f.
  */
 /* INDENT ON */
 
 #include "libm.h"
 
-extern const int _TBL_ipio2_inf[];
-extern int __rem_pio2m(double *, double *, int, int, int, const int *);
-#if defined(__i386) && !defined(__amd64)
-extern int __swapRP(int);
-#endif
+extern int __rem_pio2f(float, double *);
 
 static const double C[] = {
 	1.85735322054308378716204874632872525989806770558e-0003,
@@ -72,7 +77,7 @@ static const double C[] = {
 	9.14499072605666582228127405245558035523741471271e+0002,
 	-3.63151270591815439197122504991683846785293207730e+0001,
 	0.636619772367581343075535,	/* 2^ -1  * 1.45F306DC9C883 */
-	0.5,
+	6755399441055744.0,		/* 2^ 52  * 1.8000000000000 */
 	1.570796326734125614166,	/* 2^  0  * 1.921FB54400000 */
 	6.077100506506192601475e-11,	/* 2^-34  * 1.0B4611A626331 */
 };
@@ -87,7 +92,7 @@ static const double C[] = {
 #define	C3	C[7]
 #define	C4	C[8]
 #define	invpio2	C[9]
-#define	half	C[10]
+#define	c3two51	C[10]
 #define	pio2_1  C[11]
 #define	pio2_t	C[12]
 
@@ -96,7 +101,7 @@ sincosf(float x, float *s, float *c)
 {
 	double	y, z, w;
 	float	f, g;
-	int	n, ix, hx, hy;
+	int	n, ix, hx;
 
 	hx = *((int *)&x);
 	ix = hx & 0x7fffffff;
@@ -136,32 +141,16 @@ sincosf(float x, float *s, float *c)
 		}
 		return;
 	} else if (ix <= 0x49c90fdb) {	/* |x| < 2^19*pi */
-#if defined(__i386) && !defined(__amd64)
-		int	rp;
-
-		rp = __swapRP(fp_extended);
-#endif
-		w = y * invpio2;
-		if (hx < 0)
-			n = (int)(w - half);
-		else
-			n = (int)(w + half);
+		w = y * invpio2 + c3two51;
+		n = ((int *)&w)[LOWORD];
 		y = (y - n * pio2_1) - n * pio2_t;
-#if defined(__i386) && !defined(__amd64)
-		if (rp != fp_extended)
-			(void) __swapRP(rp);
-#endif
 	} else {
 		if (ix >= 0x7f800000) {
 			*s = *c = x / x;
 			return;
 		}
-		hy = ((int *)&y)[HIWORD];
-		n = ((hy >> 20) & 0x7ff) - 1046;
-		((int *)&w)[HIWORD] = (hy & 0xfffff) | 0x41600000;
-		((int *)&w)[LOWORD] = ((int *)&y)[LOWORD];
-		n = __rem_pio2m(&w, &y, n, 1, 0, _TBL_ipio2_inf);
-		if (hy < 0) {
+		n = __rem_pio2f(x, &y);
+		if (hx < 0) {
 			y = -y;
 			n = -n;
 		}
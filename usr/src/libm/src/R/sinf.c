@@ -33,11 +33,7 @@
 
 #include "libm.h"
 
-extern const int _TBL_ipio2_inf[];
-extern int __rem_pio2m(double *, double *, int, int, int, const int *);
-#if defined(__i386) && !defined(__amd64)
-extern int __swapRP(int);
-#endif
+extern int __rem_pio2f(float, double *);
 
 static const double C[] = {
 	1.85735322054308378716204874632872525989806770558e-0003,
@@ -50,7 +46,7 @@ static const double C[] = {
 	9.14499072605666582228127405245558035523741471271e+0002,
 	-3.63151270591815439197122504991683846785293207730e+0001,
 	0.636619772367581343075535,	/* 2^ -1  * 1.45F306DC9C883 */
-	0.5,
+	6755399441055744.0,		/* 2^ 52  * 1.8000000000000 */
 	1.570796326734125614166,	/* 2^  0  * 1.921FB54400000 */
 	6.077100506506192601475e-11,	/* 2^-34  * 1.0B4611A626331 */
 };
@@ -65,7 +61,7 @@ static const double C[] = {
 #define	C3	C[7]
 #define	C4	C[8]
 #define	invpio2	C[9]
-#define	half	C[10]
+#define	c3two51	C[10]
 #define	pio2_1  C[11]
 #define	pio2_t	C[12]
 
@@ -74,7 +70,7 @@ sinf(float x)
 {
 	double	y, z, w;
 	float	f;
-	int	n, ix, hx, hy;
+	int	n, ix, hx;
 
 	hx = *((int *)&x);
 	ix = hx & 0x7fffffff;
@@ -105,30 +101,14 @@ sinf(float x)
 			    (C3 + z * (C4 + z))));
 		}
 	} else if (ix <= 0x49c90fdb) {	/* |x| < 2^19*pi */
-#if defined(__i386) && !defined(__amd64)
-		int	rp;
-
-		rp = __swapRP(fp_extended);
-#endif
-		w = y * invpio2;
-		if (hx < 0)
-			n = (int)(w - half);
-		else
-			n = (int)(w + half);
+		w = y * invpio2 + c3two51;
+		n = ((int *)&w)[LOWORD];
 		y = (y - n * pio2_1) - n * pio2_t;
-#if defined(__i386) && !defined(__amd64)
-		if (rp != fp_extended)
-			(void) __swapRP(rp);
-#endif
 	} else {
 		if (ix >= 0x7f800000)
 			return (x / x);	/* sin(Inf or NaN) is NaN */
-		hy = ((int *)&y)[HIWORD];
-		n = ((hy >> 20) & 0x7ff) - 1046;
-		((int *)&w)[HIWORD] = (hy & 0xfffff) | 0x41600000;
-		((int *)&w)[LOWORD] = ((int *)&y)[LOWORD];
-		n = __rem_pio2m(&w, &y, n, 1, 0, _TBL_ipio2_inf);
-		if (hy < 0) {
+		n = __rem_pio2f(x, &y);
+		if (hx < 0) {
 			y = -y;
 			n = -n;
 		}
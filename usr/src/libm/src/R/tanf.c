@@ -29,11 +29,7 @@
 
 #include "libm.h"
 
-extern const int _TBL_ipio2_inf[];
-extern int __rem_pio2m(double *, double *, int, int, int, const int *);
-#if defined(__i386) && !defined(__amd64)
-extern int __swapRP(int);
-#endif
+extern int __rem_pio2f(float, double *);
 
 static const double C[] = {
 	1.0,
@@ -48,7 +44,7 @@ static const double C[] = {
 	3.333335997532835641297409611782510896641e-0001,
 	2.999997598248363761541668282006867229939e+00,
 	0.636619772367581343075535,	/* 2^ -1  * 1.45F306DC9C883 */
-	0.5,
+	6755399441055744.0,		/* 2^ 52  * 1.8000000000000 */
 	1.570796326734125614166,	/* 2^  0  * 1.921FB54400000 */
 	6.077100506506192601475e-11,	/* 2^-34  * 1.0B4611A626331 */
 };
@@ -65,7 +61,7 @@ static const double C[] = {
 #define	T0	C[9]
 #define	T1	C[10]
 #define	invpio2	C[11]
-#define	half	C[12]
+#define	c3two51	C[12]
 #define	pio2_1  C[13]
 #define	pio2_t	C[14]
 
@@ -114,30 +110,14 @@ tanf(float x)
 	}
 
 	if (ix <= 0x49c90fdb) {	/* |x| < 2^19*pi */
-#if defined(__i386) && !defined(__amd64)
-		int	rp;
-
-		rp = __swapRP(fp_extended);
-#endif
-		w = y * invpio2;
-		if (hx < 0)
-			n = (int)(w - half);
-		else
-			n = (int)(w + half);
+		w = y * invpio2 + c3two51;
+		n = ((int *)&w)[LOWORD];
 		y = (y - n * pio2_1) - n * pio2_t;
-#if defined(__i386) && !defined(__amd64)
-		if (rp != fp_extended)
-			(void) __swapRP(rp);
-#endif
 	} else {
 		if (ix >= 0x7f800000)
 			return (x / x);	/* sin(Inf or NaN) is NaN */
-		hy = ((int *)&y)[HIWORD];
-		n = ((hy >> 20) & 0x7ff) - 1046;
-		((int *)&w)[HIWORD] = (hy & 0xfffff) | 0x41600000;
-		((int *)&w)[LOWORD] = ((int *)&y)[LOWORD];
-		n = __rem_pio2m(&w, &y, n, 1, 0, _TBL_ipio2_inf);
-		if (hy < 0) {
+		n = __rem_pio2f(x, &y);
+		if (hx < 0) {
 			y = -y;
 			n = -n;
 		}
@@ -0,0 +1,141 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/processor.h>
+#include <sys/procset.h>
+#include "bench.h"
+
+const char *bench_unit = "cyc";
+
+static double ticks_per_ns = 1.0;
+
+void
+bench_init(double mhz)
+{
+	processor_info_t	pi;
+	processorid_t		cpu;
+
+	/* keep the process on one cpu so its clock and caches stay put */
+	cpu = getcpuid();
+	(void) processor_bind(P_PID, P_MYID, cpu, NULL);
+
+	if (mhz <= 0.0 && processor_info(cpu, &pi) == 0)
+		mhz = (double)pi.pi_clock;
+	if (mhz > 0.0) {
+		ticks_per_ns = mhz * 1.0e-3;
+	} else {
+		ticks_per_ns = 1.0;
+		bench_unit = "ns";
+	}
+}
+
+double
+bench_time(void (*fn)(void *), void *arg, double per, int msec, int runs)
+{
+	hrtime_t	t0, t, best, limit;
+	long		reps, i;
+
+	/* double the repeat count until one run takes long enough */
+	limit = (hrtime_t)msec * 1000000;
+	for (reps = 1; ; reps += reps) {
+		t0 = gethrtime();
+		for (i = 0; i < reps; i++)
+			(*fn)(arg);
+		best = gethrtime() - t0;
+		if (best >= limit || reps >= (1L << 30))
+			break;
+	}
+
+	while (--runs > 0) {
+		t0 = gethrtime();
+		for (i = 0; i < reps; i++)
+			(*fn)(arg);
+		t = gethrtime() - t0;
+		if (t < best)
+			best = t;
+	}
+	return ((double)best * ticks_per_ns / ((double)reps * per));
+}
+
+long double
+bench_gen(const struct dist *d, int k)
+{
+	long double	v;
+	double		u;
+
+	u = d->lo[k] + drand48() * (d->hi[k] - d->lo[k]);
+	switch (d->mode) {
+	case LOG:
+		v = scalbnl(1.0L + drand48(), (int)floor(u));
+		return ((drand48() < 0.5)? -v : v);
+	case LOGP:
+		return (scalbnl(1.0L + drand48(), (int)floor(u)));
+	}
+	return ((long double)u);
+}
+
+int
+bench_ints(const char *s, int *v, int max)
+{
+	char	*e;
+	int	n;
+
+	for (n = 0; n < max; n++) {
+		v[n] = (int)strtol(s, &e, 0);
+		if (e == s || (*e != ',' && *e != '\0'))
+			return (-1);
+		if (*e == '\0')
+			return (n + 1);
+		s = e + 1;
+	}
+	return (-1);
+}
+
+int
+bench_match(const char *name, int skip, const char *list)
+{
+	const char	*e;
+	size_t		l;
+
+	if (list == NULL)
+		return (1);
+	for (;;) {
+		e = strchr(list, ',');
+		l = (e == NULL)? strlen(list) : (size_t)(e - list);
+		if ((strlen(name) == l && strncmp(name, list, l) == 0) ||
+		    (strlen(name + skip) == l &&
+		    strncmp(name + skip, list, l) == 0))
+			return (1);
+		if (e == NULL)
+			return (0);
+		list = e + 1;
+	}
+}
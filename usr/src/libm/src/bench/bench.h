@@ -0,0 +1,82 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#ifndef _BENCH_H
+#define	_BENCH_H
+
+#include <sys/types.h>
+
+/*
+ * Helpers shared by the libm and libmvec benchmarks
+ */
+
+#define	BENCH_MAXLIST	32
+
+/*
+ * argument distributions: the first range applies to the first input
+ * of a two-input function or to the real parts of complex arguments,
+ * the second to the second input or the imaginary parts
+ */
+#define	LIN	0	/* uniform in [lo, hi] */
+#define	LOG	1	/* +-2^u with u uniform in [lo, hi] */
+#define	LOGP	2	/* 2^u with u uniform in [lo, hi] */
+
+struct dist {
+	const char	*name;
+	int		mode;
+	double		lo[2], hi[2];
+};
+
+/* bind to the current cpu and find its clock; mhz overrides if > 0 */
+extern void bench_init(double mhz);
+
+/* the unit bench_time reports in: "cyc" or, failing a clock, "ns" */
+extern const char *bench_unit;
+
+/*
+ * time fn(arg) repeated enough times to take at least msec
+ * milliseconds, best of runs tries, and return the cost of one call
+ * in bench_unit divided by per
+ */
+extern double bench_time(void (*fn)(void *), void *arg, double per,
+	int msec, int runs);
+
+/*
+ * draw a value for input k (0 or 1) from d, in long double so that
+ * the exponent ranges of the long double functions can be reached
+ */
+extern long double bench_gen(const struct dist *d, int k);
+
+/* parse a comma separated list of integers; return the count or -1 */
+extern int bench_ints(const char *s, int *v, int max);
+
+/*
+ * return nonzero if list is NULL or is a comma separated list one of
+ * whose items is name, or name without its prefix of length skip
+ */
+extern int bench_match(const char *name, int skip, const char *list);
+
+#endif	/* _BENCH_H */
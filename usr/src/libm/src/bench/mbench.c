@@ -0,0 +1,694 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * mbench - measure the latency and throughput of scalar libm functions
+ *
+ * usage: mbench [-l] [-f func,...] [-d dist,...] [-r lo,hi[,lo,hi]]
+ *	[-e lo,hi[,lo,hi]] [-n len] [-c mhz] [-t msec]
+ *
+ * For each function (or those named with -f) and each argument
+ * distribution listed for it below (or those named with -d), mbench
+ * fills an array of len (default 1000) arguments and reports
+ *
+ *	latency		cycles per call when each call's argument depends
+ *			on the previous result, so that the calls run one
+ *			after another; the figure includes the multiply
+ *			and add that carry the dependence
+ *	throughput	cycles per call when the calls are independent
+ *			and the processor can overlap them
+ *	slow		the percentage of the arguments that take the
+ *			function's slow path, named in the last column
+ *
+ * -r replaces the distributions with arguments uniform in [lo, hi],
+ * and -e with arguments +-2^u, u uniform in [lo, hi]; a second pair
+ * gives the range of the second argument of atan2, pow and hypot.
+ * The latency chain assumes finite results; a range that overflows
+ * turns the rest of the chain into NaNs.  Each figure is the best of
+ * three runs of at least msec (default 10) milliseconds, -l lists the
+ * functions and their distributions, and -c gives the clock rate in
+ * MHz if processor_info(2) does not know it.
+ *
+ * The slow paths are recognized from the arguments by the same tests
+ * the functions make, so the tests below must follow the sources.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <float.h>
+#include <math.h>
+#include "bench.h"
+
+struct args {
+	void		*x, *y;		/* arguments */
+	void		*z;		/* results */
+	int		n;
+	double		zero;		/* zero, but not known to be */
+	long double	sink;
+};
+
+/*
+ * FUNC1 and FUNC2 define lat_name and thr_name, the latency and
+ * throughput loops for f, of one or two arguments of type T
+ */
+#define	FUNC1(name, T, f)					\
+static void							\
+lat_##name(void *arg)						\
+{								\
+	struct args	*a = arg;				\
+	const T		*x = a->x;				\
+	T		r = 0, z = (T)a->zero;			\
+	int		i;					\
+								\
+	for (i = 0; i < a->n; i++)				\
+		r = f(x[i] + r * z);				\
+	a->sink = r;						\
+}								\
+								\
+static void							\
+thr_##name(void *arg)						\
+{								\
+	struct args	*a = arg;				\
+	const T		*x = a->x;				\
+	T		*z = a->z;				\
+	int		i;					\
+								\
+	for (i = 0; i < a->n; i++)				\
+		z[i] = f(x[i]);					\
+}
+
+#define	FUNC2(name, T, f)					\
+static void							\
+lat_##name(void *arg)						\
+{								\
+	struct args	*a = arg;				\
+	const T		*x = a->x, *y = a->y;			\
+	T		r = 0, z = (T)a->zero;			\
+	int		i;					\
+								\
+	for (i = 0; i < a->n; i++)				\
+		r = f(x[i] + r * z, y[i]);			\
+	a->sink = r;						\
+}								\
+								\
+static void							\
+thr_##name(void *arg)						\
+{								\
+	struct args	*a = arg;				\
+	const T		*x = a->x, *y = a->y;			\
+	T		*z = a->z;				\
+	int		i;					\
+								\
+	for (i = 0; i < a->n; i++)				\
+		z[i] = f(x[i], y[i]);				\
+}
+
+static double
+lgamma_(double x)
+{
+	int	s;
+
+	return (lgamma_r(x, &s));
+}
+
+static float
+lgammaf_(float x)
+{
+	int	s;
+
+	return (lgammaf_r(x, &s));
+}
+
+static long double
+lgammal_(long double x)
+{
+	int	s;
+
+	return (lgammal_r(x, &s));
+}
+
+FUNC1(exp, double, exp)
+FUNC1(expf, float, expf)
+FUNC1(expl, long double, expl)
+FUNC1(log, double, log)
+FUNC1(logf, float, logf)
+FUNC1(logl, long double, logl)
+FUNC2(pow, double, pow)
+FUNC2(powf, float, powf)
+FUNC2(powl, long double, powl)
+FUNC1(sin, double, sin)
+FUNC1(sinf, float, sinf)
+FUNC1(sinl, long double, sinl)
+FUNC1(cos, double, cos)
+FUNC1(cosf, float, cosf)
+FUNC1(cosl, long double, cosl)
+FUNC2(atan2, double, atan2)
+FUNC2(atan2f, float, atan2f)
+FUNC2(atan2l, long double, atan2l)
+FUNC1(cbrt, double, cbrt)
+FUNC1(cbrtf, float, cbrtf)
+FUNC1(cbrtl, long double, cbrtl)
+FUNC2(hypot, double, hypot)
+FUNC2(hypotf, float, hypotf)
+FUNC2(hypotl, long double, hypotl)
+FUNC1(erf, double, erf)
+FUNC1(erff, float, erff)
+FUNC1(erfl, long double, erfl)
+FUNC1(lgamma_r, double, lgamma_)
+FUNC1(lgammaf_r, float, lgammaf_)
+FUNC1(lgammal_r, long double, lgammal_)
+
+/*
+ * slow path tests
+ */
+static const long double
+	two25	= 33554432.0L,
+	two54	= 18014398509481984.0L,
+	two500	= 3.27339060789614187001e+150L,
+	two1023	= 8.98846567431157953865e+307L,
+	twom450	= 3.43955256707434944092e-136L;
+
+/* __rem_pio2 (C/__rem_pio2.c) and sinf.c call __rem_pio2i and __rem_pio2f */
+/* ARGSUSED1 */
+static int
+slow_trig(long double x, long double y)
+{
+	return (fabsl(x) > 1647099.3291652855L);	/* 2^19 pi */
+}
+
+/* __rem_pio2l (LD/__rem_pio2l.c) calls __rem_pio2m unless |x| <= pi/4 */
+/* ARGSUSED1 */
+static int
+slow_trigl(long double x, long double y)
+{
+	return (fabsl(x) > 0.78539816339744830962L);
+}
+
+/* exp.c scales results below 2^-1021 and calls _SVID_libm_err */
+/* ARGSUSED1 */
+static int
+slow_exp(long double x, long double y)
+{
+	return (x < -707.703L || x > 709.782712893384L);
+}
+
+/* log.c and logf.c normalize subnormal arguments */
+/* ARGSUSED1 */
+static int
+slow_log(long double x, long double y)
+{
+	return (x < DBL_MIN);
+}
+
+/* ARGSUSED1 */
+static int
+slow_logf(long double x, long double y)
+{
+	return (x < FLT_MIN);
+}
+
+/*
+ * pow.c and powf.c take the special cases for x <= 0 and results that
+ * overflow, underflow or are subnormal
+ */
+static int
+slow_pow(long double x, long double y)
+{
+	long double	t;
+
+	if (x <= 0)
+		return (1);
+	t = y * log2l(x);
+	return (t >= 1024 || t < -1022);
+}
+
+static int
+slow_powf(long double x, long double y)
+{
+	long double	t;
+
+	if (x <= 0)
+		return (1);
+	t = y * log2l(x);
+	return (t >= 128 || t < -126);
+}
+
+/* atan2.c and atan2f.c handle huge ratios and infinities separately */
+static int
+slow_atan2(long double x, long double y)
+{
+	long double	a = fabsl(x), b = fabsl(y);
+
+	if (a < b) {
+		a = b;
+		b = fabsl(x);
+	}
+	return (a >= two1023 || b * two54 <= a);
+}
+
+static int
+slow_atan2f(long double x, long double y)
+{
+	long double	a = fabsl(x), b = fabsl(y);
+
+	if (a < b) {
+		a = b;
+		b = fabsl(x);
+	}
+	return (b * two25 <= a);
+}
+
+/* cbrt.c normalizes subnormal arguments */
+/* ARGSUSED1 */
+static int
+slow_cbrt(long double x, long double y)
+{
+	return (x != 0 && fabsl(x) < DBL_MIN);
+}
+
+/* hypot.c scales arguments above 2^500 or below 2^-450 */
+static int
+slow_hypot(long double x, long double y)
+{
+	long double	a = fabsl(x), b = fabsl(y);
+
+	if (a < b) {
+		a = b;
+		b = fabsl(x);
+	}
+	return (a >= two500 || (b != 0 && b < twom450));
+}
+
+/* erf.c calls exp for 1.25 <= |x| < 6 */
+/* ARGSUSED1 */
+static int
+slow_erf(long double x, long double y)
+{
+	return (fabsl(x) >= 1.25L && fabsl(x) < 6.0L);
+}
+
+/* __lgamma.c calls sin_pi for negative arguments */
+/* ARGSUSED1 */
+static int
+slow_lgamma(long double x, long double y)
+{
+	return (x < 0);
+}
+
+/*
+ * argument distributions
+ */
+static const struct dist expd[] = {
+	{ "normal",	LIN,	{ -700, 0 },	{ 700, 0 } },
+	{ "subnormal",	LIN,	{ -745, 0 },	{ -708.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist expf_[] = {
+	{ "normal",	LIN,	{ -87, 0 },	{ 88, 0 } },
+	{ "subnormal",	LIN,	{ -103, 0 },	{ -87.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist expl_[] = {
+	{ "normal",	LIN,	{ -11000, 0 },	{ 11000, 0 } },
+	{ "subnormal",	LIN,	{ -11390, 0 },	{ -11356, 0 } },
+	{ NULL }
+};
+
+static const struct dist logd[] = {
+	{ "normal",	LOGP,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "near1",	LIN,	{ 0.9, 0 },	{ 1.1, 0 } },
+	{ "subnormal",	LOGP,	{ -1074, 0 },	{ -1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist logf_[] = {
+	{ "normal",	LOGP,	{ -126, 0 },	{ 127, 0 } },
+	{ "near1",	LIN,	{ 0.9, 0 },	{ 1.1, 0 } },
+	{ "subnormal",	LOGP,	{ -149, 0 },	{ -127, 0 } },
+	{ NULL }
+};
+
+static const struct dist logl_[] = {
+	{ "normal",	LOGP,	{ -16000, 0 },	{ 16000, 0 } },
+	{ "near1",	LIN,	{ 0.9, 0 },	{ 1.1, 0 } },
+	{ "subnormal",	LOGP,	{ -16440, 0 },	{ -16383, 0 } },
+	{ NULL }
+};
+
+static const struct dist powd[] = {
+	{ "normal",	LIN,	{ 0.5, -100 },	{ 2, 100 } },
+	{ "subnormal",	LIN,	{ 0.5, 1025 }, { 0.5005, 1070 } },
+	{ NULL }
+};
+
+static const struct dist powf_[] = {
+	{ "normal",	LIN,	{ 0.5, -20 },	{ 2, 20 } },
+	{ "subnormal",	LIN,	{ 0.5, 128 },	{ 0.505, 148 } },
+	{ NULL }
+};
+
+static const struct dist powl_[] = {
+	{ "normal",	LIN,	{ 0.5, -100 },	{ 2, 100 } },
+	{ "subnormal",	LIN,	{ 0.5, 16385 }, { 0.5005, 16440 } },
+	{ NULL }
+};
+
+static const struct dist trig[] = {
+	{ "small",	LIN,	{ -0.785, 0 },	{ 0.785, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist trigf[] = {
+	{ "small",	LIN,	{ -0.785, 0 },	{ 0.785, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 127, 0 } },
+	{ NULL }
+};
+
+static const struct dist trigl[] = {
+	{ "small",	LIN,	{ -0.785, 0 },	{ 0.785, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 16383, 0 } },
+	{ NULL }
+};
+
+static const struct dist atan2d[] = {
+	{ "normal",	LIN,	{ -10, -10 },	{ 10, 10 } },
+	{ "wide",	LOG,	{ -500, -500 },	{ 500, 500 } },
+	{ NULL }
+};
+
+static const struct dist atan2f_[] = {
+	{ "normal",	LIN,	{ -10, -10 },	{ 10, 10 } },
+	{ "wide",	LOG,	{ -60, -60 },	{ 60, 60 } },
+	{ NULL }
+};
+
+static const struct dist atan2l_[] = {
+	{ "normal",	LIN,	{ -10, -10 },	{ 10, 10 } },
+	{ "wide",	LOG,	{ -8000, -8000 }, { 8000, 8000 } },
+	{ NULL }
+};
+
+static const struct dist cbrtd[] = {
+	{ "normal",	LOG,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "subnormal",	LOG,	{ -1074, 0 },	{ -1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist cbrtf_[] = {
+	{ "normal",	LOG,	{ -126, 0 },	{ 127, 0 } },
+	{ "subnormal",	LOG,	{ -149, 0 },	{ -127, 0 } },
+	{ NULL }
+};
+
+static const struct dist cbrtl_[] = {
+	{ "normal",	LOG,	{ -16000, 0 },	{ 16000, 0 } },
+	{ "subnormal",	LOG,	{ -16440, 0 },	{ -16383, 0 } },
+	{ NULL }
+};
+
+static const struct dist hypotd[] = {
+	{ "normal",	LIN,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ "wide",	LOG,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ NULL }
+};
+
+static const struct dist hypotf_[] = {
+	{ "normal",	LIN,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ "wide",	LOG,	{ -120, -120 },	{ 120, 120 } },
+	{ NULL }
+};
+
+static const struct dist hypotl_[] = {
+	{ "normal",	LIN,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ "wide",	LOG,	{ -16000, -16000 }, { 16000, 16000 } },
+	{ NULL }
+};
+
+static const struct dist erfd[] = {
+	{ "small",	LIN,	{ -0.84, 0 },	{ 0.84, 0 } },
+	{ "tail",	LIN,	{ -6, 0 },	{ 6, 0 } },
+	{ NULL }
+};
+
+static const struct dist lgammad[] = {
+	{ "positive",	LIN,	{ 0.5, 0 },	{ 100, 0 } },
+	{ "negative",	LIN,	{ -100, 0 },	{ -0.5, 0 } },
+	{ NULL }
+};
+
+/*
+ * the functions; M(f, ...) describes f, timed by lat_f and thr_f
+ */
+#define	F	sizeof (float)
+#define	D	sizeof (double)
+#define	L	sizeof (long double)
+
+struct mfunc {
+	const char		*name;
+	void			(*lat)(void *);
+	void			(*thr)(void *);
+	size_t			size;
+	int			nargs;
+	int			(*slow)(long double, long double);
+	const char		*path;
+	const struct dist	*dist;
+};
+
+#define	M(f, size, nargs, slow, path, dist)			\
+	{ #f, lat_##f, thr_##f, size, nargs, slow, path, dist }
+
+static const struct mfunc mfuncs[] = {
+	M(exp,		D, 1, slow_exp,		"scaled",	expd),
+	M(expf,		F, 1, NULL,		NULL,		expf_),
+	M(expl,		L, 1, NULL,		NULL,		expl_),
+	M(log,		D, 1, slow_log,		"subnormal",	logd),
+	M(logf,		F, 1, slow_logf,	"subnormal",	logf_),
+	M(logl,		L, 1, NULL,		NULL,		logl_),
+	M(pow,		D, 2, slow_pow,		"special",	powd),
+	M(powf,		F, 2, slow_powf,	"special",	powf_),
+	M(powl,		L, 2, NULL,		NULL,		powl_),
+	M(sin,		D, 1, slow_trig,	"rem_pio2m",	trig),
+	M(sinf,		F, 1, slow_trig,	"rem_pio2m",	trigf),
+	M(sinl,		L, 1, slow_trigl,	"rem_pio2m",	trigl),
+	M(cos,		D, 1, slow_trig,	"rem_pio2m",	trig),
+	M(cosf,		F, 1, slow_trig,	"rem_pio2m",	trigf),
+	M(cosl,		L, 1, slow_trigl,	"rem_pio2m",	trigl),
+	M(atan2,	D, 2, slow_atan2,	"special",	atan2d),
+	M(atan2f,	F, 2, slow_atan2f,	"special",	atan2f_),
+	M(atan2l,	L, 2, NULL,		NULL,		atan2l_),
+	M(cbrt,		D, 1, slow_cbrt,	"subnormal",	cbrtd),
+	M(cbrtf,	F, 1, NULL,		NULL,		cbrtf_),
+	M(cbrtl,	L, 1, NULL,		NULL,		cbrtl_),
+	M(hypot,	D, 2, slow_hypot,	"scaled",	hypotd),
+	M(hypotf,	F, 2, NULL,		NULL,		hypotf_),
+	M(hypotl,	L, 2, NULL,		NULL,		hypotl_),
+	M(erf,		D, 1, slow_erf,		"exp",		erfd),
+	M(erff,		F, 1, NULL,		NULL,		erfd),
+	M(erfl,		L, 1, NULL,		NULL,		erfd),
+	M(lgamma_r,	D, 1, slow_lgamma,	"sin_pi",	lgammad),
+	M(lgammaf_r,	F, 1, NULL,		NULL,		lgammad),
+	M(lgammal_r,	L, 1, NULL,		NULL,		lgammad),
+	{ NULL }
+};
+
+static volatile double	vzero = 0.0;
+
+static long double
+get(const struct mfunc *f, void *p, int i)
+{
+	if (f->size == sizeof (float))
+		return (((float *)p)[i]);
+	if (f->size == sizeof (double))
+		return (((double *)p)[i]);
+	return (((long double *)p)[i]);
+}
+
+static void
+put(const struct mfunc *f, void *p, int i, long double v)
+{
+	if (f->size == sizeof (float))
+		((float *)p)[i] = (float)v;
+	else if (f->size == sizeof (double))
+		((double *)p)[i] = (double)v;
+	else
+		((long double *)p)[i] = v;
+}
+
+/* fill the arguments, time both loops and print the results */
+static void
+measure(const struct mfunc *f, const struct dist *d, struct args *a,
+	int msec)
+{
+	double	tl, tt;
+	int	i, slow;
+
+	slow = 0;
+	for (i = 0; i < a->n; i++) {
+		put(f, a->x, i, bench_gen(d, 0));
+		put(f, a->y, i, (f->nargs == 2)? bench_gen(d, 1) : 0.0L);
+		if (f->slow != NULL &&
+		    (*f->slow)(get(f, a->x, i), get(f, a->y, i)))
+			slow++;
+	}
+
+	tl = bench_time(f->lat, a, a->n, msec, 3);
+	tt = bench_time(f->thr, a, a->n, msec, 3);
+	(void) printf("%-10s %-10s %10.2f %10.2f", f->name, d->name, tl,
+	    tt);
+	if (f->slow != NULL)
+		(void) printf(" %6.1f%% %s", 100.0 * slow / a->n, f->path);
+	(void) printf("\n");
+	(void) fflush(stdout);
+}
+
+/* parse one or two comma separated lo,hi pairs into d */
+static int
+range(const char *s, struct dist *d, int mode)
+{
+	char	*e;
+	double	v[4];
+	int	n;
+
+	for (n = 0; n < 4; n++) {
+		v[n] = strtod(s, &e);
+		if (e == s || (*e != ',' && *e != '\0'))
+			return (-1);
+		s = e + 1;
+		if (*e == '\0')
+			break;
+	}
+	if (n != 1 && n != 3)
+		return (-1);
+	d->name = "range";
+	d->mode = mode;
+	d->lo[0] = d->lo[1] = v[0];
+	d->hi[0] = d->hi[1] = v[1];
+	if (n == 3) {
+		d->lo[1] = v[2];
+		d->hi[1] = v[3];
+	}
+	return (0);
+}
+
+static void
+usage(void)
+{
+	(void) fprintf(stderr, "usage: mbench [-l] [-f func,...] "
+	    "[-d dist,...] [-r lo,hi[,lo,hi]]\n\t[-e lo,hi[,lo,hi]] "
+	    "[-n len] [-c mhz] [-t msec]\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct mfunc	*f;
+	const struct dist	*d;
+	struct dist		user[2];
+	struct args		a;
+	const char		*flist = NULL, *dlist = NULL;
+	double			mhz = 0.0;
+	int			list = 0, ranged = 0, msec = 10, opt;
+
+	a.n = 1000;
+	while ((opt = getopt(argc, argv, "lf:d:r:e:n:c:t:")) != EOF) {
+		switch (opt) {
+		case 'l':
+			list = 1;
+			break;
+		case 'f':
+			flist = optarg;
+			break;
+		case 'd':
+			dlist = optarg;
+			break;
+		case 'r':
+		case 'e':
+			if (range(optarg, &user[0],
+			    (opt == 'r')? LIN : LOG) < 0)
+				usage();
+			ranged = 1;
+			break;
+		case 'n':
+			if ((a.n = atoi(optarg)) < 1)
+				usage();
+			break;
+		case 'c':
+			mhz = atof(optarg);
+			break;
+		case 't':
+			msec = atoi(optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+	user[1].name = NULL;
+
+	if (list) {
+		for (f = mfuncs; f->name != NULL; f++) {
+			(void) printf("%-10s", f->name);
+			for (d = f->dist; d->name != NULL; d++)
+				(void) printf(" %s", d->name);
+			(void) printf("\n");
+		}
+		return (0);
+	}
+
+	a.x = malloc(a.n * sizeof (long double));
+	a.y = malloc(a.n * sizeof (long double));
+	a.z = malloc(a.n * sizeof (long double));
+	if (a.x == NULL || a.y == NULL || a.z == NULL) {
+		perror("mbench");
+		return (1);
+	}
+	a.zero = vzero;
+
+	bench_init(mhz);
+	(void) printf("%-10s %-10s %10s %10s %7s\n", "function", "dist",
+	    "latency", "throughput", "slow");
+	(void) printf("%-10s %-10s %10s %10s\n", "", "", bench_unit,
+	    bench_unit);
+
+	srand48(1);
+	for (f = mfuncs; f->name != NULL; f++) {
+		if (!bench_match(f->name, 0, flist))
+			continue;
+		for (d = ranged? user : f->dist; d->name != NULL; d++) {
+			if (ranged || bench_match(d->name, 0, dlist))
+				measure(f, d, &a, msec);
+		}
+	}
+	return (0);
+}
@@ -0,0 +1,1034 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * vbench - measure the throughput of the libmvec entry points
+ *
+ * usage: vbench [-l] [-k] [-x] [-f func,...] [-d dist,...] [-n len,...]
+ *	[-s stride,...] [-c mhz] [-t msec]
+ *
+ * For each __v* function (or those named with -f, with or without
+ * the leading "__v"), each argument distribution listed for it below
+ * (or those named with -d), each stride and each vector length, vbench
+ * times the vector routine and a loop calling the corresponding scalar
+ * libm function on the same data, and prints the cost of each in
+ * cycles per element along with their ratio.  A negative stride walks
+ * the arrays backwards.  Each figure is the best of three runs of at
+ * least msec (default 10) milliseconds.  -x omits the scalar loop, -l
+ * lists the functions and their distributions, and -c gives the clock
+ * rate in MHz if processor_info(2) does not know it.
+ *
+ * -k instead checks each function (or those named with -f) against
+ * its scalar equivalent at the arguments listed in checks[] below,
+ * reports those that differ, and exits with status 1 if any do.
+ *
+ * The distributions include the inputs that send each routine down
+ * its slow path, such as huge arguments to the trig functions and
+ * results of exp and pow that underflow to subnormals, and the default
+ * lengths run from a few cache lines to well beyond the L2 cache.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <complex.h>
+#include "bench.h"
+
+static const struct dist trig[] = {
+	{ "small",	LIN,	{ -0.785, 0 },	{ 0.785, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist trigf[] = {
+	{ "small",	LIN,	{ -0.785, 0 },	{ 0.785, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 127, 0 } },
+	{ NULL }
+};
+
+static const struct dist trigpi[] = {
+	{ "small",	LIN,	{ -0.25, 0 },	{ 0.25, 0 } },
+	{ "medium",	LIN,	{ -1.0e5, 0 },	{ 1.0e5, 0 } },
+	{ "big",	LOG,	{ 21, 0 },	{ 60, 0 } },
+	{ NULL }
+};
+
+static const struct dist expd[] = {
+	{ "normal",	LIN,	{ -700, 0 },	{ 700, 0 } },
+	{ "subnormal",	LIN,	{ -745, 0 },	{ -708.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist expf_[] = {
+	{ "normal",	LIN,	{ -87, 0 },	{ 88, 0 } },
+	{ "subnormal",	LIN,	{ -103, 0 },	{ -87.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist exp2d[] = {
+	{ "normal",	LIN,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "subnormal",	LIN,	{ -1074, 0 },	{ -1022.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist exp2f_[] = {
+	{ "normal",	LIN,	{ -126, 0 },	{ 127, 0 } },
+	{ "subnormal",	LIN,	{ -149, 0 },	{ -126.5, 0 } },
+	{ NULL }
+};
+
+static const struct dist exp10d[] = {
+	{ "normal",	LIN,	{ -300, 0 },	{ 300, 0 } },
+	{ "subnormal",	LIN,	{ -323, 0 },	{ -308, 0 } },
+	{ NULL }
+};
+
+static const struct dist exp10f_[] = {
+	{ "normal",	LIN,	{ -37, 0 },	{ 38, 0 } },
+	{ "subnormal",	LIN,	{ -44.8, 0 },	{ -38, 0 } },
+	{ NULL }
+};
+
+static const struct dist expm1d[] = {
+	{ "small",	LIN,	{ -0.03, 0 },	{ 0.03, 0 } },
+	{ "normal",	LIN,	{ -40, 0 },	{ 40, 0 } },
+	{ NULL }
+};
+
+static const struct dist expm1f_[] = {
+	{ "small",	LIN,	{ -0.03, 0 },	{ 0.03, 0 } },
+	{ "normal",	LIN,	{ -87, 0 },	{ 88, 0 } },
+	{ NULL }
+};
+
+static const struct dist hypd[] = {
+	{ "small",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ "normal",	LIN,	{ -20, 0 },	{ 20, 0 } },
+	{ "big",	LIN,	{ -700, 0 },	{ 700, 0 } },
+	{ NULL }
+};
+
+static const struct dist hypf_[] = {
+	{ "small",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ "normal",	LIN,	{ -9, 0 },	{ 9, 0 } },
+	{ "big",	LIN,	{ -88, 0 },	{ 88, 0 } },
+	{ NULL }
+};
+
+static const struct dist besjd[] = {
+	{ "small",	LIN,	{ -8, 0 },	{ 8, 0 } },
+	{ "large",	LIN,	{ 8, 0 },	{ 10000, 0 } },
+	{ NULL }
+};
+
+static const struct dist besyd[] = {
+	{ "small",	LIN,	{ 0, 0 },	{ 8, 0 } },
+	{ "large",	LIN,	{ 8, 0 },	{ 10000, 0 } },
+	{ NULL }
+};
+
+static const struct dist lgammad[] = {
+	{ "small",	LIN,	{ -10, 0 },	{ 10, 0 } },
+	{ "wide",	LIN,	{ 0, 0 },	{ 1000, 0 } },
+	{ NULL }
+};
+
+static const struct dist logd[] = {
+	{ "normal",	LOGP,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "near1",	LIN,	{ 0.9, 0 },	{ 1.1, 0 } },
+	{ "subnormal",	LOGP,	{ -1074, 0 },	{ -1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist logf_[] = {
+	{ "normal",	LOGP,	{ -126, 0 },	{ 127, 0 } },
+	{ "near1",	LIN,	{ 0.9, 0 },	{ 1.1, 0 } },
+	{ "subnormal",	LOGP,	{ -149, 0 },	{ -127, 0 } },
+	{ NULL }
+};
+
+static const struct dist log1pd[] = {
+	{ "small",	LIN,	{ -0.1, 0 },	{ 0.1, 0 } },
+	{ "normal",	LOGP,	{ -1000, 0 },	{ 1000, 0 } },
+	{ NULL }
+};
+
+static const struct dist log1pf_[] = {
+	{ "small",	LIN,	{ -0.1, 0 },	{ 0.1, 0 } },
+	{ "normal",	LOGP,	{ -126, 0 },	{ 127, 0 } },
+	{ NULL }
+};
+
+static const struct dist asinhd[] = {
+	{ "small",	LIN,	{ -2, 0 },	{ 2, 0 } },
+	{ "wide",	LOG,	{ -30, 0 },	{ 100, 0 } },
+	{ NULL }
+};
+
+static const struct dist acoshd[] = {
+	{ "near1",	LIN,	{ 1, 0 },	{ 2, 0 } },
+	{ "wide",	LOGP,	{ 1, 0 },	{ 100, 0 } },
+	{ NULL }
+};
+
+static const struct dist atanhd[] = {
+	{ "small",	LIN,	{ -0.5, 0 },	{ 0.5, 0 } },
+	{ "unit",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ NULL }
+};
+
+static const struct dist cbrtd[] = {
+	{ "normal",	LOG,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "subnormal",	LOG,	{ -1074, 0 },	{ -1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist cbrtf_[] = {
+	{ "normal",	LOG,	{ -126, 0 },	{ 127, 0 } },
+	{ "subnormal",	LOG,	{ -149, 0 },	{ -127, 0 } },
+	{ NULL }
+};
+
+static const struct dist erfd[] = {
+	{ "small",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ "wide",	LIN,	{ -6, 0 },	{ 6, 0 } },
+	{ NULL }
+};
+
+static const struct dist erfcd[] = {
+	{ "small",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ "wide",	LIN,	{ -2, 0 },	{ 27, 0 } },
+	{ NULL }
+};
+
+static const struct dist erfcf_[] = {
+	{ "small",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ "wide",	LIN,	{ -2, 0 },	{ 10, 0 } },
+	{ NULL }
+};
+
+static const struct dist normd[] = {
+	{ "small",	LIN,	{ -2, 0 },	{ 2, 0 } },
+	{ "wide",	LIN,	{ -38, 0 },	{ 8, 0 } },
+	{ NULL }
+};
+
+static const struct dist normf_[] = {
+	{ "small",	LIN,	{ -2, 0 },	{ 2, 0 } },
+	{ "wide",	LIN,	{ -14, 0 },	{ 6, 0 } },
+	{ NULL }
+};
+
+static const struct dist tgammad[] = {
+	{ "small",	LIN,	{ -10, 0 },	{ 10, 0 } },
+	{ "wide",	LIN,	{ -170, 0 },	{ 170, 0 } },
+	{ NULL }
+};
+
+static const struct dist tgammaf_[] = {
+	{ "small",	LIN,	{ -10, 0 },	{ 10, 0 } },
+	{ "wide",	LIN,	{ -40, 0 },	{ 35, 0 } },
+	{ NULL }
+};
+
+static const struct dist powd[] = {
+	{ "normal",	LIN,	{ 0.5, -100 },	{ 2, 100 } },
+	{ "subnormal",	LIN,	{ 0.5, 1025 }, { 0.5005, 1070 } },
+	{ NULL }
+};
+
+static const struct dist powf_[] = {
+	{ "normal",	LIN,	{ 0.5, -20 },	{ 2, 20 } },
+	{ "subnormal",	LIN,	{ 0.5, 128 },	{ 0.505, 148 } },
+	{ NULL }
+};
+
+static const struct dist asind[] = {
+	{ "small",	LIN,	{ -0.5, 0 },	{ 0.5, 0 } },
+	{ "unit",	LIN,	{ -1, 0 },	{ 1, 0 } },
+	{ NULL }
+};
+
+static const struct dist atand[] = {
+	{ "small",	LIN,	{ -1, -1 },	{ 1, 1 } },
+	{ "wide",	LOG,	{ -60, -60 },	{ 60, 60 } },
+	{ NULL }
+};
+
+static const struct dist hypotd[] = {
+	{ "normal",	LIN,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ "wide",	LOG,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ NULL }
+};
+
+static const struct dist hypotf_[] = {
+	{ "normal",	LIN,	{ -1000, -1000 }, { 1000, 1000 } },
+	{ "wide",	LOG,	{ -120, -120 },	{ 120, 120 } },
+	{ NULL }
+};
+
+static const struct dist sqrtd[] = {
+	{ "normal",	LOGP,	{ -1000, 0 },	{ 1000, 0 } },
+	{ "subnormal",	LOGP,	{ -1074, 0 },	{ -1023, 0 } },
+	{ NULL }
+};
+
+static const struct dist sqrtf_[] = {
+	{ "normal",	LOGP,	{ -126, 0 },	{ 127, 0 } },
+	{ "subnormal",	LOGP,	{ -149, 0 },	{ -127, 0 } },
+	{ NULL }
+};
+
+static const struct dist cexpd[] = {
+	{ "normal",	LIN,	{ -10, -10 },	{ 10, 10 } },
+	{ "big",	LIN,	{ -10, 1.0e7 },	{ 10, 1.0e9 } },
+	{ NULL }
+};
+
+static const struct dist clogd[] = {
+	{ "normal",	LIN,	{ -10, -10 },	{ 10, 10 } },
+	{ "wide",	LOG,	{ -120, -120 },	{ 120, 120 } },
+	{ NULL }
+};
+
+static const struct dist cpowd[] = {
+	{ "normal",	LIN,	{ -2, -2 },	{ 2, 2 } },
+	{ NULL }
+};
+
+/*
+ * scalar loops with the same calling sequences as the vector routines
+ */
+#define	LOOP_U(name, T, f)					\
+static void							\
+name(int n, T *x, int sx, T *y, int sy)				\
+{								\
+	for (; n > 0; n--, x += sx, y += sy)			\
+		*y = f(*x);					\
+}
+
+#define	LOOP_B(name, T, f)					\
+static void							\
+name(int n, T *x, int sx, T *y, int sy, T *z, int sz)		\
+{								\
+	for (; n > 0; n--, x += sx, y += sy, z += sz)		\
+		*z = f(*x, *y);					\
+}
+
+/* libm has these, but <math.h> does not declare them */
+extern double exp10(double);
+extern float exp10f(float);
+extern void sincospi(double, double *, double *);
+extern void sincospif(float, float *, float *);
+extern double atan2pi(double, double);
+extern float atan2pif(float, float);
+
+static double
+rsqrt_(double x)
+{
+	return (1.0 / sqrt(x));
+}
+
+static float
+rsqrtf_(float x)
+{
+	return (1.0f / sqrtf(x));
+}
+
+static double
+rhypot_(double x, double y)
+{
+	return (1.0 / hypot(x, y));
+}
+
+static float
+rhypotf_(float x, float y)
+{
+	return (1.0f / hypotf(x, y));
+}
+
+static double
+normcdf_(double x)
+{
+	return (0.5 * erfc(-x * 0.70710678118654752440));
+}
+
+static float
+normcdff_(float x)
+{
+	return (0.5f * erfcf(-x * 0.70710678118654752440f));
+}
+
+static double
+sinpi_(double x)
+{
+	double	s, c;
+
+	sincospi(x, &s, &c);
+	return (s);
+}
+
+static float
+sinpif_(float x)
+{
+	float	s, c;
+
+	sincospif(x, &s, &c);
+	return (s);
+}
+
+static double
+cospi_(double x)
+{
+	double	s, c;
+
+	sincospi(x, &s, &c);
+	return (c);
+}
+
+static float
+cospif_(float x)
+{
+	float	s, c;
+
+	sincospif(x, &s, &c);
+	return (c);
+}
+
+LOOP_U(s_acos, double, acos)
+LOOP_U(s_acosf, float, acosf)
+LOOP_U(s_acosh, double, acosh)
+LOOP_U(s_acoshf, float, acoshf)
+LOOP_U(s_asin, double, asin)
+LOOP_U(s_asinf, float, asinf)
+LOOP_U(s_asinh, double, asinh)
+LOOP_U(s_asinhf, float, asinhf)
+LOOP_U(s_atan, double, atan)
+LOOP_U(s_atanf, float, atanf)
+LOOP_U(s_atanh, double, atanh)
+LOOP_U(s_atanhf, float, atanhf)
+LOOP_U(s_cbrt, double, cbrt)
+LOOP_U(s_cbrtf, float, cbrtf)
+LOOP_U(s_cos, double, cos)
+LOOP_U(s_cosf, float, cosf)
+LOOP_U(s_cosh, double, cosh)
+LOOP_U(s_coshf, float, coshf)
+LOOP_U(s_cospi, double, cospi_)
+LOOP_U(s_cospif, float, cospif_)
+LOOP_U(s_erf, double, erf)
+LOOP_U(s_erfc, double, erfc)
+LOOP_U(s_erfcf, float, erfcf)
+LOOP_U(s_erff, float, erff)
+LOOP_U(s_exp, double, exp)
+LOOP_U(s_exp10, double, exp10)
+LOOP_U(s_exp10f, float, exp10f)
+LOOP_U(s_exp2, double, exp2)
+LOOP_U(s_exp2f, float, exp2f)
+LOOP_U(s_expf, float, expf)
+LOOP_U(s_expm1, double, expm1)
+LOOP_U(s_expm1f, float, expm1f)
+LOOP_U(s_j0, double, j0)
+LOOP_U(s_j1, double, j1)
+LOOP_U(s_log, double, log)
+LOOP_U(s_log10, double, log10)
+LOOP_U(s_log10f, float, log10f)
+LOOP_U(s_log1p, double, log1p)
+LOOP_U(s_log1pf, float, log1pf)
+LOOP_U(s_log2, double, log2)
+LOOP_U(s_log2f, float, log2f)
+LOOP_U(s_logf, float, logf)
+LOOP_U(s_normcdf, double, normcdf_)
+LOOP_U(s_normcdff, float, normcdff_)
+LOOP_U(s_rsqrt, double, rsqrt_)
+LOOP_U(s_rsqrtf, float, rsqrtf_)
+LOOP_U(s_sin, double, sin)
+LOOP_U(s_sinf, float, sinf)
+LOOP_U(s_sinh, double, sinh)
+LOOP_U(s_sinhf, float, sinhf)
+LOOP_U(s_sinpi, double, sinpi_)
+LOOP_U(s_sinpif, float, sinpif_)
+LOOP_U(s_sqrt, double, sqrt)
+LOOP_U(s_sqrtf, float, sqrtf)
+LOOP_U(s_tan, double, tan)
+LOOP_U(s_tanf, float, tanf)
+LOOP_U(s_tanh, double, tanh)
+LOOP_U(s_tanhf, float, tanhf)
+LOOP_U(s_tgamma, double, tgamma)
+LOOP_U(s_tgammaf, float, tgammaf)
+LOOP_U(s_y0, double, y0)
+LOOP_U(s_y1, double, y1)
+LOOP_B(s_atan2, double, atan2)
+LOOP_B(s_atan2f, float, atan2f)
+LOOP_B(s_atan2pi, double, atan2pi)
+LOOP_B(s_atan2pif, float, atan2pif)
+LOOP_B(s_hypot, double, hypot)
+LOOP_B(s_hypotf, float, hypotf)
+LOOP_B(s_pow, double, pow)
+LOOP_B(s_powf, float, powf)
+LOOP_B(s_rhypot, double, rhypot_)
+LOOP_B(s_rhypotf, float, rhypotf_)
+
+static void
+s_sincos(int n, double *x, int sx, double *s, int ss, double *c, int sc)
+{
+	for (; n > 0; n--, x += sx, s += ss, c += sc)
+		sincos(*x, s, c);
+}
+
+static void
+s_sincosf(int n, float *x, int sx, float *s, int ss, float *c, int sc)
+{
+	for (; n > 0; n--, x += sx, s += ss, c += sc)
+		sincosf(*x, s, c);
+}
+
+static void
+s_sincospi(int n, double *x, int sx, double *s, int ss, double *c, int sc)
+{
+	for (; n > 0; n--, x += sx, s += ss, c += sc)
+		sincospi(*x, s, c);
+}
+
+static void
+s_sincospif(int n, float *x, int sx, float *s, int ss, float *c, int sc)
+{
+	for (; n > 0; n--, x += sx, s += ss, c += sc)
+		sincospif(*x, s, c);
+}
+
+static void
+s_lgamma(int n, double *x, int sx, double *y, int sy, int *s, int ss)
+{
+	for (; n > 0; n--, x += sx, y += sy, s += ss)
+		*y = lgamma_r(*x, s);
+}
+
+static void
+s_lgammaf(int n, float *x, int sx, float *y, int sy, int *s, int ss)
+{
+	for (; n > 0; n--, x += sx, y += sy, s += ss)
+		*y = lgammaf_r(*x, s);
+}
+
+static void
+s_c_abs(int n, float complex *x, int sx, float *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = cabsf(*x);
+}
+
+static void
+s_z_abs(int n, double complex *x, int sx, double *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = cabs(*x);
+}
+
+static void
+s_c_exp(int n, float complex *x, int sx, float complex *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = cexpf(*x);
+}
+
+static void
+s_z_exp(int n, double complex *x, int sx, double complex *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = cexp(*x);
+}
+
+static void
+s_c_log(int n, float complex *x, int sx, float complex *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = clogf(*x);
+}
+
+static void
+s_z_log(int n, double complex *x, int sx, double complex *y, int sy)
+{
+	for (; n > 0; n--, x += sx, y += sy)
+		*y = clog(*x);
+}
+
+static void
+s_c_pow(int n, float complex *x, int sx, float complex *y, int sy,
+	float complex *z, int sz)
+{
+	for (; n > 0; n--, x += sx, y += sy, z += sz)
+		*z = cpowf(*x, *y);
+}
+
+static void
+s_z_pow(int n, double complex *x, int sx, double complex *y, int sy,
+	double complex *z, int sz)
+{
+	for (; n > 0; n--, x += sx, y += sy, z += sz)
+		*z = cpow(*x, *y);
+}
+
+/*
+ * the entry points; none of them has a prototype in a public header
+ */
+extern void __vacos(), __vacosf(), __vacosh(), __vacoshf(), __vasin();
+extern void __vasinf(), __vasinh(), __vasinhf(), __vatan(), __vatan2();
+extern void __vatan2f(), __vatan2pi(), __vatan2pif(), __vatanf();
+extern void __vatanh(), __vatanhf(), __vc_abs(), __vc_exp();
+extern void __vc_exp_fused(), __vc_log(), __vc_pow(), __vcbrt();
+extern void __vcbrtf(), __vcos(), __vcosf(), __vcosh(), __vcoshf();
+extern void __vcospi(), __vcospif(), __verf(), __verfc(), __verfcf();
+extern void __verff(), __vexp(), __vexp10(), __vexp10f(), __vexp2();
+extern void __vexp2f(), __vexpf(), __vexpm1(), __vexpm1f(), __vhypot();
+extern void __vhypotf(), __vj0(), __vj1(), __vlgamma(), __vlgammaf();
+extern void __vlog(), __vlog10(), __vlog10f(), __vlog1p(), __vlog1pf();
+extern void __vlog2(), __vlog2f(), __vlogf(), __vnormcdf();
+extern void __vnormcdff(), __vpow(), __vpowf(), __vrhypot();
+extern void __vrhypotf(), __vrsqrt(), __vrsqrtf(), __vsin();
+extern void __vsincos(), __vsincosf(), __vsincospi(), __vsincospif();
+extern void __vsinf(), __vsinh(), __vsinhf(), __vsinpi(), __vsinpif();
+extern void __vsqrt(), __vsqrtf(), __vtan(), __vtanf(), __vtanh();
+extern void __vtanhf(), __vtgamma(), __vtgammaf(), __vy0(), __vy1();
+extern void __vz_abs(), __vz_exp(), __vz_exp_fused(), __vz_log();
+extern void __vz_pow();
+
+/*
+ * calling sequences:
+ *	U	(n, x, stridex, y, stridey)
+ *	B	(n, x, stridex, y, stridey, z, stridez)
+ *	E	(n, x, stridex, y, stridey, tmp)
+ *	P	(n, x, stridex, y, stridey, z, stridez, tmp)
+ *	S	(n, x, stridex, y, stridey, s, strides), s an int array
+ * the inputs are x for U, E and S and x and y for B and P
+ */
+#define	U	0
+#define	B	1
+#define	E	2
+#define	P	3
+#define	S	4
+
+#define	F	sizeof (float)
+#define	D	sizeof (double)
+
+struct vfunc {
+	const char		*name;
+	void			(*vec)();
+	void			(*ref)();
+	int			kind;
+	size_t			size;	/* size of a real */
+	int			esz[3];
+	const struct dist	*dist;
+};
+
+/*
+ * V(f, ...) describes __vf, whose scalar equivalent is s_f; the sizes
+ * are the number of reals per element of x, y and z
+ */
+#define	V(f, kind, size, ex, ey, ez, dist)			\
+	{ "__v" #f, __v##f, s_##f, kind, size, { ex, ey, ez }, dist }
+
+#define	s_c_exp_fused	s_c_exp
+#define	s_z_exp_fused	s_z_exp
+
+static const struct vfunc vfuncs[] = {
+	V(acos,		U, D, 1, 1, 0,	asind),
+	V(acosf,	U, F, 1, 1, 0,	asind),
+	V(acosh,	U, D, 1, 1, 0,	acoshd),
+	V(acoshf,	U, F, 1, 1, 0,	acoshd),
+	V(asin,		U, D, 1, 1, 0,	asind),
+	V(asinf,	U, F, 1, 1, 0,	asind),
+	V(asinh,	U, D, 1, 1, 0,	asinhd),
+	V(asinhf,	U, F, 1, 1, 0,	asinhd),
+	V(atan,		U, D, 1, 1, 0,	atand),
+	V(atan2,	B, D, 1, 1, 1,	atand),
+	V(atan2f,	B, F, 1, 1, 1,	atand),
+	V(atan2pi,	B, D, 1, 1, 1,	atand),
+	V(atan2pif,	B, F, 1, 1, 1,	atand),
+	V(atanf,	U, F, 1, 1, 0,	atand),
+	V(atanh,	U, D, 1, 1, 0,	atanhd),
+	V(atanhf,	U, F, 1, 1, 0,	atanhd),
+	V(c_abs,	U, F, 2, 1, 0,	hypotf_),
+	V(c_exp,	E, F, 2, 2, 0,	cexpd),
+	V(c_exp_fused,	U, F, 2, 2, 0,	cexpd),
+	V(c_log,	U, F, 2, 2, 0,	clogd),
+	V(c_pow,	P, F, 2, 2, 2,	cpowd),
+	V(cbrt,		U, D, 1, 1, 0,	cbrtd),
+	V(cbrtf,	U, F, 1, 1, 0,	cbrtf_),
+	V(cos,		U, D, 1, 1, 0,	trig),
+	V(cosf,		U, F, 1, 1, 0,	trigf),
+	V(cosh,		U, D, 1, 1, 0,	hypd),
+	V(coshf,	U, F, 1, 1, 0,	hypf_),
+	V(cospi,	U, D, 1, 1, 0,	trigpi),
+	V(cospif,	U, F, 1, 1, 0,	trigpi),
+	V(erf,		U, D, 1, 1, 0,	erfd),
+	V(erfc,		U, D, 1, 1, 0,	erfcd),
+	V(erfcf,	U, F, 1, 1, 0,	erfcf_),
+	V(erff,		U, F, 1, 1, 0,	erfd),
+	V(exp,		U, D, 1, 1, 0,	expd),
+	V(exp10,	U, D, 1, 1, 0,	exp10d),
+	V(exp10f,	U, F, 1, 1, 0,	exp10f_),
+	V(exp2,		U, D, 1, 1, 0,	exp2d),
+	V(exp2f,	U, F, 1, 1, 0,	exp2f_),
+	V(expf,		U, F, 1, 1, 0,	expf_),
+	V(expm1,	U, D, 1, 1, 0,	expm1d),
+	V(expm1f,	U, F, 1, 1, 0,	expm1f_),
+	V(hypot,	B, D, 1, 1, 1,	hypotd),
+	V(hypotf,	B, F, 1, 1, 1,	hypotf_),
+	V(j0,		U, D, 1, 1, 0,	besjd),
+	V(j1,		U, D, 1, 1, 0,	besjd),
+	V(lgamma,	S, D, 1, 1, 1,	lgammad),
+	V(lgammaf,	S, F, 1, 1, 1,	lgammad),
+	V(log,		U, D, 1, 1, 0,	logd),
+	V(log10,	U, D, 1, 1, 0,	logd),
+	V(log10f,	U, F, 1, 1, 0,	logf_),
+	V(log1p,	U, D, 1, 1, 0,	log1pd),
+	V(log1pf,	U, F, 1, 1, 0,	log1pf_),
+	V(log2,		U, D, 1, 1, 0,	logd),
+	V(log2f,	U, F, 1, 1, 0,	logf_),
+	V(logf,		U, F, 1, 1, 0,	logf_),
+	V(normcdf,	U, D, 1, 1, 0,	normd),
+	V(normcdff,	U, F, 1, 1, 0,	normf_),
+	V(pow,		B, D, 1, 1, 1,	powd),
+	V(powf,		B, F, 1, 1, 1,	powf_),
+	V(rhypot,	B, D, 1, 1, 1,	hypotd),
+	V(rhypotf,	B, F, 1, 1, 1,	hypotf_),
+	V(rsqrt,	U, D, 1, 1, 0,	sqrtd),
+	V(rsqrtf,	U, F, 1, 1, 0,	sqrtf_),
+	V(sin,		U, D, 1, 1, 0,	trig),
+	V(sincos,	B, D, 1, 1, 1,	trig),
+	V(sincosf,	B, F, 1, 1, 1,	trigf),
+	V(sincospi,	B, D, 1, 1, 1,	trigpi),
+	V(sincospif,	B, F, 1, 1, 1,	trigpi),
+	V(sinf,		U, F, 1, 1, 0,	trigf),
+	V(sinh,		U, D, 1, 1, 0,	hypd),
+	V(sinhf,	U, F, 1, 1, 0,	hypf_),
+	V(sinpi,	U, D, 1, 1, 0,	trigpi),
+	V(sinpif,	U, F, 1, 1, 0,	trigpi),
+	V(sqrt,		U, D, 1, 1, 0,	sqrtd),
+	V(sqrtf,	U, F, 1, 1, 0,	sqrtf_),
+	V(tan,		U, D, 1, 1, 0,	trig),
+	V(tanf,		U, F, 1, 1, 0,	trigf),
+	V(tanh,		U, D, 1, 1, 0,	hypd),
+	V(tanhf,	U, F, 1, 1, 0,	hypf_),
+	V(tgamma,	U, D, 1, 1, 0,	tgammad),
+	V(tgammaf,	U, F, 1, 1, 0,	tgammaf_),
+	V(y0,		U, D, 1, 1, 0,	besyd),
+	V(y1,		U, D, 1, 1, 0,	besyd),
+	V(z_abs,	U, D, 2, 1, 0,	hypotd),
+	V(z_exp,	E, D, 2, 2, 0,	cexpd),
+	V(z_exp_fused,	U, D, 2, 2, 0,	cexpd),
+	V(z_log,	U, D, 2, 2, 0,	clogd),
+	V(z_pow,	P, D, 2, 2, 2,	cpowd),
+	{ NULL }
+};
+
+/*
+ * arguments at which a one-input routine has given a wrong result;
+ * with -k, the vector result must equal the scalar one, or both must
+ * be NaN
+ */
+struct check {
+	const char	*name;
+	double		x;
+};
+
+static const struct check checks[] = {
+	/* |x| > 1 must give NaN, not +-0 */
+	{ "__vatanh",	1.0e16 },
+	{ "__vatanh",	1.0e20 },
+	{ "__vatanh",	-1.0e20 },
+	{ "__vatanhf",	1.0e16 },
+	{ "__vatanhf",	1.0e20 },
+	{ "__vatanhf",	-1.0e20 },
+	{ NULL }
+};
+
+/* one call to time */
+struct call {
+	const struct vfunc	*f;
+	void			(*fn)();
+	int			n, s;
+	char			*buf[3];	/* the arrays */
+	char			*a[3];		/* where the call starts */
+	void			*tmp;
+};
+
+static void
+run(void *arg)
+{
+	struct call	*c = arg;
+
+	switch (c->f->kind) {
+	case U:
+		(*c->fn)(c->n, c->a[0], c->s, c->a[1], c->s);
+		break;
+	case B:
+	case S:
+		(*c->fn)(c->n, c->a[0], c->s, c->a[1], c->s, c->a[2], c->s);
+		break;
+	case E:
+		(*c->fn)(c->n, c->a[0], c->s, c->a[1], c->s, c->tmp);
+		break;
+	case P:
+		(*c->fn)(c->n, c->a[0], c->s, c->a[1], c->s, c->a[2], c->s,
+		    c->tmp);
+		break;
+	}
+}
+
+/* fill the first m reals of each input array from the distribution */
+static void
+fill(const struct vfunc *f, const struct dist *d, char **buf, int m)
+{
+	long double	v;
+	int		i, k, nin;
+
+	nin = (f->kind == B || f->kind == P)? 2 : 1;
+	for (k = 0; k < nin; k++) {
+		for (i = 0; i < m; i++) {
+			/* the imaginary parts of complex data use range 1 */
+			v = bench_gen(d, (f->esz[k] == 2)? (i & 1) : k);
+			if (f->size == sizeof (float))
+				((float *)buf[k])[i] = (float)v;
+			else
+				((double *)buf[k])[i] = (double)v;
+		}
+	}
+}
+
+/* time the vector routine and the scalar loop and print the results */
+static void
+measure(struct call *c, const struct dist *d, int scalar, int msec)
+{
+	const struct vfunc	*f = c->f;
+	double			tv, ts;
+	int			k;
+
+	/* with a negative stride, start at the end of the arrays */
+	for (k = 0; k < 3; k++) {
+		c->a[k] = c->buf[k];
+		if (c->s < 0)
+			c->a[k] += (size_t)(c->n - 1) * -c->s * f->esz[k] *
+			    ((f->kind == S && k == 2)? sizeof (int) : f->size);
+	}
+
+	c->fn = f->vec;
+	tv = bench_time(run, c, c->n, msec, 3);
+	(void) printf("%-16s %-10s %6d %8d %10.2f", f->name, d->name, c->s,
+	    c->n, tv);
+	if (scalar) {
+		c->fn = f->ref;
+		ts = bench_time(run, c, c->n, msec, 3);
+		(void) printf(" %10.2f %7.2f", ts, ts / tv);
+	}
+	(void) printf("\n");
+	(void) fflush(stdout);
+}
+
+/* run the checks for the functions in flist; return the failure count */
+static int
+check(const char *flist)
+{
+	const struct check	*k;
+	const struct vfunc	*f;
+	double			xd, yd, rd;
+	float			xf, yf, rf;
+	int			bad = 0;
+
+	for (k = checks; k->name != NULL; k++) {
+		if (!bench_match(k->name, 3, flist))
+			continue;
+		for (f = vfuncs; f->name != NULL; f++)
+			if (strcmp(f->name, k->name) == 0)
+				break;
+		if (f->name == NULL || f->kind != U)
+			continue;
+		if (f->size == sizeof (float)) {
+			xf = (float)k->x;
+			(*f->vec)(1, &xf, 1, &yf, 1);
+			(*f->ref)(1, &xf, 1, &rf, 1);
+			if (memcmp(&yf, &rf, sizeof (float)) == 0 ||
+			    (isnan(yf) && isnan(rf)))
+				continue;
+			yd = yf;
+			rd = rf;
+		} else {
+			xd = k->x;
+			(*f->vec)(1, &xd, 1, &yd, 1);
+			(*f->ref)(1, &xd, 1, &rd, 1);
+			if (memcmp(&yd, &rd, sizeof (double)) == 0 ||
+			    (isnan(yd) && isnan(rd)))
+				continue;
+		}
+		(void) printf("%s(%a) = %a, scalar gives %a\n", f->name,
+		    k->x, yd, rd);
+		bad++;
+	}
+	(void) printf("%d check%s failed\n", bad, (bad == 1)? "" : "s");
+	return (bad);
+}
+
+static void
+usage(void)
+{
+	(void) fprintf(stderr, "usage: vbench [-l] [-k] [-x] [-f func,...] "
+	    "[-d dist,...] [-n len,...]\n\t[-s stride,...] [-c mhz] "
+	    "[-t msec]\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct vfunc	*f;
+	const struct dist	*d;
+	const char		*flist = NULL, *dlist = NULL;
+	struct call		c;
+	double			mhz = 0.0;
+	size_t			len;
+	int			lens[BENCH_MAXLIST], strides[BENCH_MAXLIST];
+	int			nlens, nstrides, maxn, maxs, msec = 10;
+	int			list = 0, chk = 0, scalar = 1, i, j, k, opt;
+
+	lens[0] = 16;
+	lens[1] = 256;
+	lens[2] = 4096;
+	lens[3] = 65536;
+	lens[4] = 1048576;
+	nlens = 5;
+	strides[0] = 1;
+	strides[1] = 3;
+	nstrides = 2;
+
+	while ((opt = getopt(argc, argv, "lkxf:d:n:s:c:t:")) != EOF) {
+		switch (opt) {
+		case 'l':
+			list = 1;
+			break;
+		case 'k':
+			chk = 1;
+			break;
+		case 'x':
+			scalar = 0;
+			break;
+		case 'f':
+			flist = optarg;
+			break;
+		case 'd':
+			dlist = optarg;
+			break;
+		case 'n':
+			if ((nlens = bench_ints(optarg, lens,
+			    BENCH_MAXLIST)) < 0)
+				usage();
+			break;
+		case 's':
+			if ((nstrides = bench_ints(optarg, strides,
+			    BENCH_MAXLIST)) < 0)
+				usage();
+			break;
+		case 'c':
+			mhz = atof(optarg);
+			break;
+		case 't':
+			msec = atoi(optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+
+	if (list) {
+		for (f = vfuncs; f->name != NULL; f++) {
+			(void) printf("%-16s", f->name);
+			for (d = f->dist; d->name != NULL; d++)
+				(void) printf(" %s", d->name);
+			(void) printf("\n");
+		}
+		return (0);
+	}
+
+	if (chk)
+		return (check(flist) != 0);
+
+	maxn = maxs = 1;
+	for (i = 0; i < nlens; i++) {
+		if (lens[i] < 1)
+			usage();
+		if (lens[i] > maxn)
+			maxn = lens[i];
+	}
+	for (j = 0; j < nstrides; j++) {
+		if (strides[j] == 0)
+			usage();
+		if (abs(strides[j]) > maxs)
+			maxs = abs(strides[j]);
+	}
+
+	/* room for maxn complex doubles at the largest stride */
+	len = (size_t)maxn * maxs * 2 * sizeof (double);
+	for (k = 0; k < 3; k++) {
+		if ((c.buf[k] = malloc(len)) == NULL) {
+			perror("vbench");
+			return (1);
+		}
+		(void) memset(c.buf[k], 0, len);
+	}
+	if ((c.tmp = malloc((size_t)maxn * 8 * sizeof (double))) == NULL) {
+		perror("vbench");
+		return (1);
+	}
+
+	bench_init(mhz);
+	(void) printf("%-16s %-10s %6s %8s %10s %10s %7s\n", "function",
+	    "dist", "stride", "n", "vector", "scalar", "ratio");
+	(void) printf("%-16s %-10s %6s %8s %10s %10s\n", "", "", "", "",
+	    bench_unit, bench_unit);
+
+	srand48(1);
+	for (f = vfuncs; f->name != NULL; f++) {
+		if (!bench_match(f->name, 3, flist))
+			continue;
+		c.f = f;
+		for (d = f->dist; d->name != NULL; d++) {
+			if (!bench_match(d->name, 0, dlist))
+				continue;
+			for (j = 0; j < nstrides; j++) {
+				c.s = strides[j];
+				fill(f, d, c.buf, maxn * abs(c.s) * f->esz[0]);
+				for (i = 0; i < nlens; i++) {
+					c.n = lens[i];
+					measure(&c, d, scalar, msec);
+				}
+			}
+		}
+	}
+	return (0);
+}
@@ -80,6 +80,17 @@ ifdef(`LOCALLIBM',`
 	addl	$4,%esp
 	.end
 /
+/ return the rounding precision, as __swapRP does, without changing it
+/
+	.inline	NAME(__getRP),0
+	subl	$4,%esp
+	fstcw	(%esp)
+	movzwl	(%esp),%eax
+	shrl	$8,%eax
+	andl	$0x3,%eax
+	addl	$4,%esp
+	.end
+/
 / 00 - Round to nearest, with even preferred
 / 01 - Round down
 / 10 - Round up
@@ -67,7 +67,9 @@ void (*__libm_mt_fex_sync)() = NULL; /* new, improved version of above */
 static fex_handler_t main_handlers;
 static int handlers_initialized = 0;
 static thread_key_t handlers_key;
+static volatile int handlers_key_created = 0;
 static mutex_t handlers_key_lock = DEFAULTMUTEX;
+static __thread struct fex_handler_data *thr_handlers_cache = NULL;
 
 static struct sigaction oact = { 0, SIG_DFL };
 static mutex_t hdlr_lock = DEFAULTMUTEX;
@@ -750,7 +752,9 @@ not_ieee:
 
 /*
 *  Return a pointer to the thread-specific handler data, and
-*  initialize it if necessary
+*  initialize it if necessary.  Once a thread's data exist, the
+*  pointer is found in thread-local storage without taking a lock;
+*  the key is kept only so the data are freed when the thread exits.
 */
 struct fex_handler_data *
 __fex_get_thr_handlers()
@@ -773,30 +777,34 @@ __fex_get_thr_handlers()
 		return main_handlers;
 	}
 	else {
-		ptr = NULL;
-		mutex_lock(&handlers_key_lock);
-		if (thr_getspecific(handlers_key, (void **)&ptr) != 0 &&
-			thr_keycreate(&handlers_key, free) != 0) {
+		if ((ptr = thr_handlers_cache) != NULL)
+			return ptr;
+		if (!handlers_key_created) {
+			mutex_lock(&handlers_key_lock);
+			if (!handlers_key_created) {
+				if (thr_keycreate(&handlers_key, free) != 0) {
+					mutex_unlock(&handlers_key_lock);
+					return NULL;
+				}
+				handlers_key_created = 1;
+			}
 			mutex_unlock(&handlers_key_lock);
+		}
+		if ((ptr = (struct fex_handler_data *)
+			malloc(sizeof(fex_handler_t))) == NULL) {
 			return NULL;
 		}
-		mutex_unlock(&handlers_key_lock);
-		if (!ptr) {
-			if ((ptr = (struct fex_handler_data *)
-				malloc(sizeof(fex_handler_t))) == NULL) {
-				return NULL;
-			}
-			if (thr_setspecific(handlers_key, (void *)ptr) != 0) {
-				(void)free(ptr);
-				return NULL;
-			}
-			/* initialize to FEX_NOHANDLER if trap is enabled,
-			   FEX_NONSTOP if trap is disabled */
-			__fenv_getfsr(&fsr);
-			te = (int)__fenv_get_te(fsr);
-			for (i = 0; i < FEX_NUM_EXC; i++)
-				ptr[i].__mode = ((te & te_bit[i])? FEX_NOHANDLER : FEX_NONSTOP);
+		if (thr_setspecific(handlers_key, (void *)ptr) != 0) {
+			(void)free(ptr);
+			return NULL;
 		}
+		/* initialize to FEX_NOHANDLER if trap is enabled,
+		   FEX_NONSTOP if trap is disabled */
+		__fenv_getfsr(&fsr);
+		te = (int)__fenv_get_te(fsr);
+		for (i = 0; i < FEX_NUM_EXC; i++)
+			ptr[i].__mode = ((te & te_bit[i])? FEX_NOHANDLER : FEX_NONSTOP);
+		thr_handlers_cache = ptr;
 		return ptr;
 	}
 }
@@ -54,8 +54,14 @@ int _sse_hw = 0;
 
 static int accrued = 0;
 static thread_key_t accrued_key;
+static volatile int accrued_key_created = 0;
 static mutex_t accrued_key_lock = DEFAULTMUTEX;
+static __thread int *accrued_cache = NULL;
 
+/*
+*  Return a pointer to the thread's accrued flags; as with the
+*  handler data, the lookup takes no lock once the flags exist
+*/
 int *
 __fex_accrued()
 {
@@ -64,23 +70,27 @@ __fex_accrued()
 	if (thr_main())
 		return &accrued;
 	else {
-		p = NULL;
-		mutex_lock(&accrued_key_lock);
-		if (thr_getspecific(accrued_key, (void **)&p) != 0 &&
-			thr_keycreate(&accrued_key, free) != 0) {
+		if ((p = accrued_cache) != NULL)
+			return p;
+		if (!accrued_key_created) {
+			mutex_lock(&accrued_key_lock);
+			if (!accrued_key_created) {
+				if (thr_keycreate(&accrued_key, free) != 0) {
+					mutex_unlock(&accrued_key_lock);
+					return NULL;
+				}
+				accrued_key_created = 1;
+			}
 			mutex_unlock(&accrued_key_lock);
-			return NULL;
 		}
-		mutex_unlock(&accrued_key_lock);
-		if (!p) {
-			if ((p = (int*) malloc(sizeof(int))) == NULL)
-				return NULL;
-			if (thr_setspecific(accrued_key, (void *)p) != 0) {
-				(void)free(p);
-				return NULL;
-			}
-			*p = 0;
+		if ((p = (int*) malloc(sizeof(int))) == NULL)
+			return NULL;
+		if (thr_setspecific(accrued_key, (void *)p) != 0) {
+			(void)free(p);
+			return NULL;
 		}
+		*p = 0;
+		accrued_cache = p;
 		return p;
 	}
 }
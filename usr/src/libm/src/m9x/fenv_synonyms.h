@@ -64,6 +64,9 @@
 #define fex_get_log_depth	__fex_get_log_depth
 #define fex_set_log_depth	__fex_set_log_depth
 #define fex_log_entry		__fex_log_entry
+#define fex_get_log_async	__fex_get_log_async
+#define fex_set_log_async	__fex_set_log_async
+#define fex_log_flush		__fex_log_flush
 
 /* libc, libthread */
 #define close			_close
@@ -75,11 +78,15 @@
 #define mutex_unlock	_mutex_unlock
 #define open			_open
 #define read			_read
+#define sema_init		_sema_init
+#define sema_post		_sema_post
+#define sema_wait		_sema_wait
 #define sigaction		_sigaction
 #define sigemptyset		_sigemptyset
 #define sigismember		_sigismember
 #define sigprocmask		_sigprocmask
 #define stat			_stat
+#define thr_create		_thr_create
 #define thr_getspecific	_thr_getspecific
 #define thr_keycreate	_thr_keycreate
 #define thr_main		_thr_main
@@ -31,6 +31,9 @@
 #pragma weak fex_get_log_depth = __fex_get_log_depth
 #pragma weak fex_set_log_depth = __fex_set_log_depth
 #pragma weak fex_log_entry = __fex_log_entry
+#pragma weak fex_get_log_async = __fex_get_log_async
+#pragma weak fex_set_log_async = __fex_set_log_async
+#pragma weak fex_log_flush = __fex_log_flush
 
 #include "fenv_synonyms.h"
 #include <stdio.h>
@@ -40,9 +43,12 @@
 #include <signal.h>
 #include <ucontext.h>
 #include <sys/frame.h>
+#include <sys/types.h>
 #include <fenv.h>
 #include <sys/ieeefp.h>
 #include <thread.h>
+#include <synch.h>
+#include <atomic.h>
 #include "fex_handler.h"
 
 #if !defined(PC)
@@ -53,9 +59,10 @@
 #endif
 #endif
 
-static FILE *log_fp = NULL;
+static FILE *volatile log_fp = NULL;
 static mutex_t log_lock = DEFAULTMUTEX;
 static int log_depth = 100;
+static volatile int log_async = 0;
 
 FILE *fex_get_log(void)
 {
@@ -69,6 +76,9 @@ FILE *fex_get_log(void)
 
 int fex_set_log(FILE *fp)
 {
+	/* pending records belong to the old log */
+	if (log_async)
+		fex_log_flush();
 	mutex_lock(&log_lock);
 	log_fp = fp;
 	mutex_unlock(&log_lock);
@@ -96,14 +106,6 @@ int fex_set_log_depth(int d)
 	return 1;
 }
 
-static struct exc_list {
-	struct exc_list		*next;
-	char			*addr;
-	unsigned long		code;
-	int			nstack;
-	char			*stack[1]; /* actual length is max(1,nstack) */
-} *list = NULL;
-
 #ifdef __sparcv9
 #define FRAMEP(X)	(struct frame *)((char*)(X)+(((long)(X)&1)?2047:0))
 #else
@@ -116,6 +118,87 @@ static struct exc_list {
 #define PDIG		"8"
 #endif
 
+/*
+* Entries already made are remembered in an open-addressed table by
+* the address, the exception (or message), and a 64-bit hash of the
+* stack to log_depth frames.  A slot is claimed with compare-and-swap
+* on a hash of all three, after which its fields are filled in, so
+* the table can be searched from the signal handler in any thread
+* without a lock; a match must agree in every field.  If the table
+* fills up, synchronous logging goes on with the malloc'd exc_list
+* under log_lock, as it always has, while asynchronous logging treats
+* the entry as made already rather than take a lock in the handler.
+*/
+#define EXC_TABLE_SIZE	1024	/* must be a power of two */
+
+static struct exc_slot {
+	volatile uint64_t	key;	/* hash of the rest; 0 if free */
+	uint64_t		stack;	/* hash of the stack */
+	char			*addr;
+	unsigned long		code;
+	volatile uint32_t	valid;	/* the fields above are set */
+} exc_table[EXC_TABLE_SIZE];
+
+static struct exc_list {
+	struct exc_list		*next;
+	char			*addr;
+	unsigned long		code;
+	int			nstack;
+	char			*stack[1]; /* actual length is max(1,nstack) */
+} *list = NULL;
+
+#define MIX(h, v)	(h = (h ^ (uint64_t)(unsigned long)(v)) * \
+			    0x100000001b3ull, h ^= h >> 29)
+
+/* look for a matching entry in the table; return 1 if one is found,
+   otherwise add this one to the table and return 0, or return -1 if
+   the table is full */
+static int check_exc_table(char *addr, unsigned long code, char *stk,
+    struct frame *fp)
+{
+	struct exc_slot	*t;
+	struct frame	*f;
+	uint64_t	h, sh, v;
+	int		i, n;
+
+	sh = 0;
+	if (log_depth > 0) {
+		MIX(sh, stk);
+		for (i = 1, f = fp; i < log_depth && f && f->fr_savpc;
+		    i++, f = FRAMEP(f->fr_savfp))
+			MIX(sh, f->fr_savpc);
+	}
+	h = 0xcbf29ce484222325ull;
+	MIX(h, addr);
+	MIX(h, code);
+	MIX(h, sh);
+	if (h == 0)
+		h = 1;
+
+	for (n = 0, i = (int)h & (EXC_TABLE_SIZE - 1); n < EXC_TABLE_SIZE;
+	    n++, i = (i + 1) & (EXC_TABLE_SIZE - 1)) {
+		t = &exc_table[i];
+		if ((v = t->key) == 0 &&
+		    (v = atomic_cas_64(&t->key, 0, h)) == 0) {
+			t->stack = sh;
+			t->addr = addr;
+			t->code = code;
+			membar_producer();
+			t->valid = 1;
+			return 0;
+		}
+		/* a slot still being filled in, perhaps by this thread in
+		   an interrupted handler, is passed over rather than waited
+		   for; at worst the entry is then made twice */
+		if (v != h || !t->valid)
+			continue;
+		membar_consumer();
+		if (t->addr == addr && t->code == code && t->stack == sh)
+			return 1;
+	}
+	return -1;
+}
+
 /* look for a matching exc_list; return 1 if one is found,
    otherwise add this one to the list and return 0 */
 static int check_exc_list(char *addr, unsigned long code, char *stk,
@@ -167,6 +250,18 @@ static int check_exc_list(char *addr, unsigned long code, char *stk,
 	return 0;
 }
 
+/* check for an entry made already, as above; called with log_lock
+   held, so the list can take over when the table is full */
+static int check_exc(char *addr, unsigned long code, char *stk,
+    struct frame *fp)
+{
+	int	r;
+
+	if ((r = check_exc_table(addr, code, stk, fp)) >= 0)
+		return r;
+	return check_exc_list(addr, code, stk, fp);
+}
+
 /*
 * Warning: cleverness ahead
 *
@@ -194,28 +289,339 @@ static int check_exc_list(char *addr, unsigned long code, char *stk,
 * concern here, I opted for the safe and dumb route.)
 */
 
+/* print one line of a stack trace; return 1 at main */
+static int print_pc(int fd, char *addr)
+{
+	char	*name, buf[30];
+
+	if (__fex_sym(addr, &name) != NULL) {
+		write(fd, buf, sprintf(buf, "  0x%0" PDIG "lx  ",
+		    (long)addr));
+		write(fd, name, strlen(name));
+		write(fd, "\n", 1);
+		if (!strcmp(name, "main"))
+			return 1;
+	} else {
+		write(fd, buf, sprintf(buf, "  0x%0" PDIG "lx\n",
+		    (long)addr));
+	}
+	return 0;
+}
+
 static void print_stack(int fd, char *addr, struct frame *fp)
 {
 	int	i;
-	char	*name, buf[30];
 
 	for (i = 0; i < log_depth && addr != NULL; i++) {
-		if (__fex_sym(addr, &name) != NULL) {
-			write(fd, buf, sprintf(buf, "  0x%0" PDIG "lx  ",
-			    (long)addr));
+		if (print_pc(fd, addr))
+			break;
+		if (fp == NULL)
+			break;
+		addr = (char *)fp->fr_savpc;
+		fp = FRAMEP(fp->fr_savfp);
+	}
+}
+
+static const char *exception[FEX_NUM_EXC] = {
+	"inexact result",
+	"division by zero",
+	"underflow",
+	"overflow",
+	"invalid operation (0/0)",
+	"invalid operation (inf/inf)",
+	"invalid operation (inf-inf)",
+	"invalid operation (0*inf)",
+	"invalid operation (sqrt)",
+	"invalid operation (snan)",
+	"invalid operation (int)",
+	"invalid operation (cmp)"
+};
+
+/* print the first line of an entry for exception e */
+static void print_exc(int fd, char *addr, enum fex_exception e, int m,
+    void *p)
+{
+	char	*name, buf[30];
+
+	write(fd, "Floating point ", 15);
+	write(fd, exception[e], strlen(exception[e]));
+	write(fd, buf, sprintf(buf, " at 0x%0" PDIG "lx", (long)addr));
+	__fex_sym_init();
+	if (__fex_sym(addr, &name) != NULL) {
+		write(fd, " ", 1);
+		write(fd, name, strlen(name));
+	}
+	switch (m) {
+	case FEX_NONSTOP:
+		write(fd, ", nonstop mode\n", 15);
+		break;
+
+	case FEX_ABORT:
+		write(fd, ", abort\n", 8);
+		break;
+
+	case FEX_NOHANDLER:
+		if (p == (void *)SIG_DFL) {
+			write(fd, ", handler: SIG_DFL\n", 19);
+			break;
+		}
+		else if (p == (void *)SIG_IGN) {
+			write(fd, ", handler: SIG_IGN\n", 19);
+			break;
+		}
+		/* fall through*/
+	default:
+		write(fd, ", handler: ", 11);
+		if (__fex_sym((char *)p, &name) != NULL) {
 			write(fd, name, strlen(name));
 			write(fd, "\n", 1);
-			if (!strcmp(name, "main"))
-				break;
 		} else {
-			write(fd, buf, sprintf(buf, "  0x%0" PDIG "lx\n",
-			    (long)addr));
+			write(fd, buf, sprintf(buf, "0x%0" PDIG "lx\n",
+			    (long)p));
 		}
+		break;
+	}
+}
+
+/*
+* Asynchronous logging
+*
+* When fex_set_log_async(1) is in effect, an entry is not written
+* from the thread that incurs the exception.  Instead the thread
+* copies a fixed-size record into a ring of its own, and a daemon
+* thread (or any caller of fex_log_flush) later writes the records
+* out in the usual format.  A ring has a single producer, its own
+* thread, and is emptied only while flush_lock is held, so neither
+* side needs a lock to move records.  Records that don't fit in the
+* ring, or that arrive while the thread is already adding one, are
+* counted and reported at the next flush.  Only the first LOG_MAXSTACK
+* frames of each stack are kept.
+*
+* A thread claims its ring when it calls fex_set_log_async(1) or
+* fex_log_entry, outside the signal handler, because thr_setspecific
+* (which frees the ring when the thread exits) is not async-signal-
+* safe.  A thread without a ring, having made neither call or found
+* every ring in use, logs synchronously as before.
+*/
+#define LOG_NRINGS	64	/* rings; one per thread using them */
+#define LOG_NRECS	32	/* records per ring; a power of two */
+#define LOG_MAXSTACK	32
+#define LOG_MSGLEN	80
+
+#define RING_FREE	0
+#define RING_INUSE	1
+#define RING_EXITED	2
+
+struct log_rec {
+	char	*addr;
+	void	*handler;
+	int	e;		/* exception, or -1 for fex_log_entry */
+	int	mode;
+	int	nstack;
+	char	*stack[LOG_MAXSTACK];
+	char	msg[LOG_MSGLEN];
+};
+
+struct log_ring {
+	volatile uint32_t	state;
+	volatile uint32_t	head;	/* advanced by the owning thread */
+	volatile uint32_t	tail;	/* advanced under flush_lock */
+	volatile uint32_t	dropped;
+	struct log_rec		rec[LOG_NRECS];
+};
+
+static struct log_ring *rings = NULL;
+static volatile uint32_t rings_dropped = 0;
+static thread_key_t ring_key;
+static sema_t log_sema;
+static mutex_t flush_lock = DEFAULTMUTEX;
+static __thread struct log_ring *thr_ring = NULL;
+static __thread int thr_logging = 0;
+
+/* called when a thread that owns a ring exits */
+static void ring_exit(void *p)
+{
+	((struct log_ring *)p)->state = RING_EXITED;
+	(void) sema_post(&log_sema);
+}
+
+/* claim a ring for this thread; not to be called from the handler */
+static void claim_ring(void)
+{
+	int	i;
+
+	if (thr_ring != NULL || rings == NULL)
+		return;
+	for (i = 0; i < LOG_NRINGS; i++) {
+		if (atomic_cas_32(&rings[i].state, RING_FREE, RING_INUSE) !=
+		    RING_FREE)
+			continue;
+		if (thr_setspecific(ring_key, (void *)&rings[i]) != 0)
+			rings[i].state = RING_FREE;
+		else
+			thr_ring = &rings[i];
+		return;
+	}
+}
+
+/* append a record to this thread's ring, which it must have, and
+   wake the daemon */
+static void log_push(char *addr, int e, int m, void *p, const char *msg,
+    char *stk, struct frame *fp)
+{
+	struct log_ring	*r;
+	struct log_rec	*l;
+	uint32_t	h;
+	int		i;
+
+	/* a SIGFPE taken while this thread is in here is dropped */
+	if (thr_logging) {
+		atomic_inc_32(&rings_dropped);
+		return;
+	}
+	thr_logging = 1;
+	r = thr_ring;
+	h = r->head;
+	if (h - r->tail >= LOG_NRECS) {
+		atomic_inc_32(&r->dropped);
+		thr_logging = 0;
+		return;
+	}
+	l = &r->rec[h & (LOG_NRECS - 1)];
+	l->addr = addr;
+	l->e = e;
+	l->mode = m;
+	l->handler = p;
+	l->nstack = 0;
+	for (i = 0; i < log_depth && i < LOG_MAXSTACK && stk != NULL; i++) {
+		l->stack[l->nstack++] = stk;
 		if (fp == NULL)
 			break;
-		addr = (char *)fp->fr_savpc;
+		stk = (char *)fp->fr_savpc;
 		fp = FRAMEP(fp->fr_savfp);
 	}
+	if (msg != NULL) {
+		(void) strncpy(l->msg, msg, LOG_MSGLEN - 1);
+		l->msg[LOG_MSGLEN - 1] = '\0';
+	}
+	membar_producer();
+	r->head = h + 1;
+	thr_logging = 0;
+	(void) sema_post(&log_sema);
+}
+
+/* write out the records in r; called with flush_lock held */
+static void ring_drain(struct log_ring *r)
+{
+	struct log_rec	*l;
+	uint32_t	t, d;
+	char		buf[40];
+	int		fd, i;
+
+	while ((t = r->tail) != r->head) {
+		membar_consumer();
+		l = &r->rec[t & (LOG_NRECS - 1)];
+		mutex_lock(&log_lock);
+		if (log_fp != NULL) {
+			fd = fileno(log_fp);
+			if (l->e < 0) {
+				write(fd, "fex_log_entry: ", 15);
+				write(fd, l->msg, strlen(l->msg));
+				write(fd, "\n", 1);
+				__fex_sym_init();
+			} else {
+				print_exc(fd, l->addr, (enum fex_exception)l->e,
+				    l->mode, l->handler);
+			}
+			for (i = 0; i < l->nstack; i++)
+				if (print_pc(fd, l->stack[i]))
+					break;
+		}
+		mutex_unlock(&log_lock);
+		membar_exit();
+		r->tail = t + 1;
+	}
+	if ((d = r->dropped) != 0) {
+		atomic_add_32(&r->dropped, -(int32_t)d);
+		atomic_add_32(&rings_dropped, (int32_t)d);
+	}
+	if (rings_dropped != 0) {
+		mutex_lock(&log_lock);
+		d = rings_dropped;
+		atomic_add_32(&rings_dropped, -(int32_t)d);
+		if (log_fp != NULL)
+			write(fileno(log_fp), buf, sprintf(buf,
+			    "fex_log: %u entries dropped\n", d));
+		mutex_unlock(&log_lock);
+	}
+}
+
+void fex_log_flush(void)
+{
+	struct log_ring	*r;
+	uint32_t	s;
+	int		i;
+
+	mutex_lock(&flush_lock);
+	for (i = 0; rings != NULL && i < LOG_NRINGS; i++) {
+		r = &rings[i];
+		if ((s = r->state) == RING_FREE)
+			continue;
+		ring_drain(r);
+		if (s == RING_EXITED) {
+			r->head = r->tail = r->dropped = 0;
+			membar_producer();
+			r->state = RING_FREE;
+		}
+	}
+	mutex_unlock(&flush_lock);
+}
+
+/* ARGSUSED */
+static void *log_daemon(void *arg)
+{
+	for (;;) {
+		(void) sema_wait(&log_sema);
+		fex_log_flush();
+	}
+	/* NOTREACHED */
+	return NULL;
+}
+
+int fex_get_log_async(void)
+{
+	return log_async;
+}
+
+int fex_set_log_async(int on)
+{
+	struct log_ring	*r;
+
+	mutex_lock(&log_lock);
+	if (on && rings == NULL) {
+		if ((r = (struct log_ring *)calloc(LOG_NRINGS,
+		    sizeof(struct log_ring))) == NULL ||
+		    thr_keycreate(&ring_key, ring_exit) != 0) {
+			mutex_unlock(&log_lock);
+			free(r);
+			return 0;
+		}
+		(void) sema_init(&log_sema, 0, USYNC_THREAD, NULL);
+		if (thr_create(NULL, 0, log_daemon, NULL,
+		    THR_DAEMON | THR_DETACHED, NULL) != 0) {
+			mutex_unlock(&log_lock);
+			free(r);
+			return 0;
+		}
+		rings = r;
+	}
+	log_async = (on != 0);
+	mutex_unlock(&log_lock);
+	if (on)
+		claim_ring();
+	else
+		fex_log_flush();
+	return 1;
 }
 
 void fex_log_entry(const char *msg)
@@ -226,11 +632,8 @@ void fex_log_entry(const char *msg)
 	int		fd;
 
 	/* if logging is disabled, just return */
-	mutex_lock(&log_lock);
-	if (log_fp == NULL) {
-		mutex_unlock(&log_lock);
+	if (log_fp == NULL)
 		return;
-	}
 
 	/* get the frame pointer from the current context and
 	   pop our own frame */
@@ -242,15 +645,23 @@ void fex_log_entry(const char *msg)
 #else
 #error Unknown architecture
 #endif
-	if (fp == NULL) {
-		mutex_unlock(&log_lock);
+	if (fp == NULL)
 		return;
-	}
 	stk = (char *)fp->fr_savpc;
 	fp = FRAMEP(fp->fr_savfp);
 
 	/* if we've already logged this message here, don't make an entry */
-	if (check_exc_list(stk, (unsigned long)msg, stk, fp)) {
+	if (log_async) {
+		claim_ring();
+		if (thr_ring != NULL) {
+			if (check_exc_table(stk, (unsigned long)msg, stk,
+			    fp) == 0)
+				log_push(stk, -1, 0, NULL, msg, stk, fp);
+			return;
+		}
+	}
+	mutex_lock(&log_lock);
+	if (log_fp == NULL || check_exc(stk, (unsigned long)msg, stk, fp)) {
 		mutex_unlock(&log_lock);
 		return;
 	}
@@ -265,134 +676,72 @@ void fex_log_entry(const char *msg)
 	mutex_unlock(&log_lock);
 }
 
-static const char *exception[FEX_NUM_EXC] = {
-	"inexact result",
-	"division by zero",
-	"underflow",
-	"overflow",
-	"invalid operation (0/0)",
-	"invalid operation (inf/inf)",
-	"invalid operation (inf-inf)",
-	"invalid operation (0*inf)",
-	"invalid operation (sqrt)",
-	"invalid operation (snan)",
-	"invalid operation (int)",
-	"invalid operation (cmp)"
-};
-
 void
 __fex_mklog(ucontext_t *uap, char *addr, int f, enum fex_exception e,
     int m, void *p)
 {
 	struct	frame	*fp;
-	char		*stk, *name, buf[30];
-	int		fd;
+	char		*stk;
+	int		fd, ex;
 
 	/* if logging is disabled, just return */
-	mutex_lock(&log_lock);
-	if (log_fp == NULL) {
-		mutex_unlock(&log_lock);
+	if (log_fp == NULL)
 		return;
-	}
-
-	/* get stack info */
-#if defined(__sparc)
-	stk = (char*)uap->uc_mcontext.gregs[REG_PC];
-	fp = FRAMEP(uap->uc_mcontext.gregs[REG_SP]);
-#elif defined(__amd64)
-	stk = (char*)uap->uc_mcontext.gregs[REG_PC];
-	fp = FRAMEP(uap->uc_mcontext.gregs[REG_RBP]);
-#elif defined(__i386)	/* !defined(__amd64) */
-	stk = (char*)uap->uc_mcontext.gregs[PC];
-	fp = FRAMEP(uap->uc_mcontext.gregs[EBP]);
-#else
-#error Unknown architecture
-#endif
 
 	/* if the handling mode is the default and this exception's
 	   flag is already raised, don't make an entry */
 	if (m == FEX_NONSTOP) {
 		switch (e) {
 		case fex_inexact:
-			if (f & FE_INEXACT) {
-				mutex_unlock(&log_lock);
-				return;
-			}
+			ex = FE_INEXACT;
 			break;
 		case fex_underflow:
-			if (f & FE_UNDERFLOW) {
-				mutex_unlock(&log_lock);
-				return;
-			}
+			ex = FE_UNDERFLOW;
 			break;
 		case fex_overflow:
-			if (f & FE_OVERFLOW) {
-				mutex_unlock(&log_lock);
-				return;
-			}
+			ex = FE_OVERFLOW;
 			break;
 		case fex_division:
-			if (f & FE_DIVBYZERO) {
-				mutex_unlock(&log_lock);
-				return;
-			}
+			ex = FE_DIVBYZERO;
 			break;
 		default:
-			if (f & FE_INVALID) {
-				mutex_unlock(&log_lock);
-				return;
-			}
+			ex = FE_INVALID;
 			break;
 		}
+		if (f & ex)
+			return;
 	}
 
+	/* get stack info */
+#if defined(__sparc)
+	stk = (char*)uap->uc_mcontext.gregs[REG_PC];
+	fp = FRAMEP(uap->uc_mcontext.gregs[REG_SP]);
+#elif defined(__amd64)
+	stk = (char*)uap->uc_mcontext.gregs[REG_PC];
+	fp = FRAMEP(uap->uc_mcontext.gregs[REG_RBP]);
+#elif defined(__i386)	/* !defined(__amd64) */
+	stk = (char*)uap->uc_mcontext.gregs[PC];
+	fp = FRAMEP(uap->uc_mcontext.gregs[EBP]);
+#else
+#error Unknown architecture
+#endif
+
 	/* if we've already logged this exception at this address,
 	   don't make an entry */
-	if (check_exc_list(addr, (unsigned long)e, stk, fp)) {
+	if (log_async && thr_ring != NULL) {
+		if (check_exc_table(addr, (unsigned long)e, stk, fp) == 0)
+			log_push(addr, (int)e, m, p, NULL, stk, fp);
+		return;
+	}
+	mutex_lock(&log_lock);
+	if (log_fp == NULL || check_exc(addr, (unsigned long)e, stk, fp)) {
 		mutex_unlock(&log_lock);
 		return;
 	}
 
 	/* make an entry */
 	fd = fileno(log_fp);
-	write(fd, "Floating point ", 15);
-	write(fd, exception[e], strlen(exception[e]));
-	write(fd, buf, sprintf(buf, " at 0x%0" PDIG "lx", (long)addr));
-	__fex_sym_init();
-	if (__fex_sym(addr, &name) != NULL) {
-		write(fd, " ", 1);
-		write(fd, name, strlen(name));
-	}
-	switch (m) {
-	case FEX_NONSTOP:
-		write(fd, ", nonstop mode\n", 15);
-		break;
-
-	case FEX_ABORT:
-		write(fd, ", abort\n", 8);
-		break;
-
-	case FEX_NOHANDLER:
-		if (p == (void *)SIG_DFL) {
-			write(fd, ", handler: SIG_DFL\n", 19);
-			break;
-		}
-		else if (p == (void *)SIG_IGN) {
-			write(fd, ", handler: SIG_IGN\n", 19);
-			break;
-		}
-		/* fall through*/
-	default:
-		write(fd, ", handler: ", 11);
-		if (__fex_sym((char *)p, &name) != NULL) {
-			write(fd, name, strlen(name));
-			write(fd, "\n", 1);
-		} else {
-			write(fd, buf, sprintf(buf, "0x%0" PDIG "lx\n",
-			    (long)p));
-		}
-		break;
-	}
+	print_exc(fd, addr, e, m, p);
 	print_stack(fd, stk, fp);
 	mutex_unlock(&log_lock);
 }
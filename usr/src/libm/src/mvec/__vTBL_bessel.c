@@ -0,0 +1,111 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+#pragma align 32 (__vlibm_TBL_bessel)
+
+/*
+ Tables shared by __vj0, __vj1, __vy0 and __vy1.
+
+ The rational approximations of j0.c and j1.c to the amplitude
+ functions of the asymptotic expansions for x > 8, in z = (8/x)^2:
+ P(0,x) = p(z)/q(z) at k = 0, Q(0,x) = (8/x)*p(z)/q(z) at k = 16, and
+ P(1,x), Q(1,x) likewise at k = 32, 48.  Each polynomial is of degree
+ 6, padded with a zero to 8 doubles:
+ TBL[k+i]   = numerator coefficient of z^i, i = [0,6]
+ TBL[k+8+i] = denominator coefficient of z^i, i = [0,6]
+*/
+
+const double __vlibm_TBL_bessel[] = {
+/* P(0,x): numerator, denominator */
+ 4.86134418338605246390e+04,	/* 40E7BCAE, 2380C3A7 */
+ 1.37766254940711223753e+05,	/* 4100D132, 0A1E5B09 */
+ 1.22246636408828970161e+05,	/* 40FDD86A, 2EBB0635 */
+ 4.10707008431517606368e+04,	/* 40E40DD6, 6D4E9E0E */
+ 5.02607380186063710426e+03,	/* 40B3A212, E4ADC1D2 */
+ 1.78319365912547965536e+02,	/* 40664A38, 3EDCBB39 */
+ 8.80103440553834270865e-01,	/* 3FEC29CE, B0C8D357 */
+ 0.0,
+ 4.86134418338605246390e+04,	/* 40E7BCAE, 2380C3A7 */
+ 1.37819663263038470177e+05,	/* 4100D2DD, 4E5CDA17 */
+ 1.22396718534100655233e+05,	/* 40FDE1CB, 7F1D9CF6 */
+ 4.12015024379535389016e+04,	/* 40E41E30, 13F8C257 */
+ 5.06827118105354657018e+03,	/* 40B3CC45, 6C1F1C47 */
+ 1.82981790547277000769e+02,	/* 4066DF6A, D4028274 */
+ 1.00000000000000000000e+00,	/* 3FF00000, 00000000 */
+ 0.0,
+/* Q(0,x): numerator, denominator */
+-1.73121099570106849797e+02,	/* C065A3E0, 0C34A565 */
+-5.52255916593616689170e+02,	/* C081420C, 1DFFC0B3 */
+-5.60493560663734683658e+02,	/* C08183F2, CFEEEAA9 */
+-2.20043030022600930806e+02,	/* C06B8160, 807F7A26 */
+-3.23869355375648879658e+01,	/* C0403187, 1A8BC02D */
+-1.42949792079079562868e+00,	/* BFF6DF39, 3637F186 */
+-8.34690374102384918809e-03,	/* BF81182E, 74B97634 */
+ 0.0,
+ 1.10797503724868383870e+04,	/* 40C5A3E0, 0C34A565 */
+ 3.54458168062708282378e+04,	/* 40E14EBA, 2346E78C */
+ 3.61911893791839393089e+04,	/* 40E1ABE6, 0F64EF32 */
+ 1.43989556356539796980e+04,	/* 40CC1F7A, 5244E45E */
+ 2.19027702334436389719e+03,	/* 40A11C8D, D600F88B */
+ 1.06695157020407989990e+02,	/* 405AAC7D, 73DF0F2D */
+ 1.00000000000000000000e+00,	/* 3FF00000, 00000000 */
+ 0.0,
+/* P(1,x): numerator, denominator */
+-4.43575781679412815720e+06,	/* C150EBCB, 74465AE1 */
+-9.94224650507764145732e+06,	/* C162F69C, D0299896 */
+-6.60337324836493935436e+06,	/* C159309B, 4FE5360F */
+-1.52352935118113737553e+06,	/* C1373F49, 59E701CC */
+-1.09824055434593465179e+05,	/* C0FAD000, E30F6260 */
+-1.61161664432461020624e+03,	/* C0992E77, 719C1DDC */
+ 0.0,
+ 0.0,
+-4.43575781679412815720e+06,	/* C150EBCB, 74465AE1 */
+-9.93412438993458636105e+06,	/* C162F2A5, 8C7A5819 */
+-6.58533947972308751196e+06,	/* C1591EFE, DEB3C877 */
+-1.51180950663416087627e+06,	/* C1371181, 81B2C6C0 */
+-1.07263859911038205610e+05,	/* C0FA2FFD, C23213A9 */
+-1.45500944019049620692e+03,	/* C096BC09, AAB075CC */
+ 1.00000000000000000000e+00,	/* 3FF00000, 00000000 */
+ 0.0,
+/* Q(1,x): numerator, denominator */
+ 3.32209134098572249059e+04,	/* 40E0389D, 3AA74F14 */
+ 8.51451606753357045818e+04,	/* 40F4C992, 92204D02 */
+ 6.61788365812708361773e+04,	/* 40F0282D, 62A30AEB */
+ 1.84942628732238663360e+04,	/* 40D20F90, D2EA36E0 */
+ 1.70637542902076802420e+03,	/* 409AA980, 707718AC */
+ 3.52651338466360328994e+01,	/* 4041A1EF, E7E82EA6 */
+ 0.0,
+ 0.0,
+ 7.08712819410287425853e+05,	/* 4125A0D1, A389BEC5 */
+ 1.81945804224399733357e+06,	/* 413BC342, 0AD080AB */
+ 1.41946066960372100584e+06,	/* 4135A8C4, AB6B2643 */
+ 4.00294435822669765912e+05,	/* 41186E99, BE484C46 */
+ 3.78902297457722015679e+04,	/* 40E28047, 5A13CE40 */
+ 8.63836776960499150846e+02,	/* 408AFEB1, B81E7B1F */
+ 1.00000000000000000000e+00,	/* 3FF00000, 00000000 */
+ 0.0,
+};
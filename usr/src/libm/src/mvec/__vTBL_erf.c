@@ -0,0 +1,157 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#pragma align 32 (__vlibm_TBL_erf)
+
+/*
+ Tables shared by __verf, __verfc, __vnormcdf and their float versions.
+
+ The rational approximations of erf.c on its four intervals k = 0, 1, 2,
+ 3, padded with zeros to a common degree so that every element evaluates
+ the same p(u)/q(u) whatever its interval:
+ TBL[16*k+i]   = p_i, i = [0,7]
+ TBL[16*k+8+i] = q_(i+1), i = [0,7], q_0 = 1
+
+ The argument u of each interval and the masks that pick its result:
+ u = (TBL[64+8*k]*z + TBL[64+8*k+1]*|x| + TBL[64+8*k+2]) /
+     (TBL[64+8*k+3]*z + TBL[64+8*k+4]),  z = x*x,
+ that is x*x, |x|-1, 1/(x*x), 1/(x*x) for k = 0, 1, 2, 3;
+ TBL[64+8*k+5] = 1 where erfc(|x|) comes from exp(-x*x-0.5625+p/q)/|x|
+ TBL[64+8*k+6] = 1 where erf(x) = x+x*p/q
+
+ j = [0,31]
+ TBL[96+2*j]   = 2^(j/32) rounded to double
+ TBL[96+2*j+1] = 2^(j/32) - TBL[96+2*j] rounded to double
+*/
+
+const double __vlibm_TBL_erf[] = {
+/* [0, 0.84375): p0 ... p7, q1 ... q8 */
+ 1.28379167095512558561e-01,	/* 3FC06EBA, 8214DB68 */
+-3.25042107247001499370e-01,	/* BFD4CD7D, 691CB913 */
+-2.84817495755985104766e-02,	/* BF9D2A51, DBD7194F */
+-5.77027029648944159157e-03,	/* BF77A291, 236668E4 */
+-2.37630166566501626084e-05,	/* BEF8EAD6, 120016AC */
+ 0.0,
+ 0.0,
+ 0.0,
+ 3.97917223959155352819e-01,	/* 3FD97779, CDDADC09 */
+ 6.50222499887672944485e-02,	/* 3FB0A54C, 5536CEBA */
+ 5.08130628187576562776e-03,	/* 3F74D022, C4D36B0F */
+ 1.32494738004321644526e-04,	/* 3F215DC9, 221C1A10 */
+-3.96022827877536812320e-06,	/* BED09C43, 42A26120 */
+ 0.0,
+ 0.0,
+ 0.0,
+/* [0.84375, 1.25): p0 ... p7, q1 ... q8 */
+-2.36211856075265944077e-03,	/* BF6359B8, BEF77538 */
+ 4.14856118683748331666e-01,	/* 3FDA8D00, AD92B34D */
+-3.72207876035701323847e-01,	/* BFD7D240, FBB8C3F1 */
+ 3.18346619901161753674e-01,	/* 3FD45FCA, 805120E4 */
+-1.10894694282396677476e-01,	/* BFBC6398, 3D3E28EC */
+ 3.54783043256182359371e-02,	/* 3FA22A36, 599795EB */
+-2.16637559486879084300e-03,	/* BF61BF38, 0A96073F */
+ 0.0,
+ 1.06420880400844228286e-01,	/* 3FBB3E66, 18EEE323 */
+ 5.40397917702171048937e-01,	/* 3FE14AF0, 92EB6F33 */
+ 7.18286544141962662868e-02,	/* 3FB2635C, D99FE9A7 */
+ 1.26171219808761642112e-01,	/* 3FC02660, E763351F */
+ 1.36370839120290507362e-02,	/* 3F8BEDC2, 6B51DD1C */
+ 1.19844998467991074170e-02,	/* 3F888B54, 5735151D */
+ 0.0,
+ 0.0,
+/* [1.25, 1/0.35): p0 ... p7, q1 ... q8 */
+-9.86494403484714822705e-03,	/* BF843412, 600D6435 */
+-6.93858572707181764372e-01,	/* BFE63416, E4BA7360 */
+-1.05586262253232909814e+01,	/* C0251E04, 41B0E726 */
+-6.23753324503260060396e+01,	/* C04F300A, E4CBA38D */
+-1.62396669462573470355e+02,	/* C0644CB1, 84282266 */
+-1.84605092906711035994e+02,	/* C067135C, EBCCABB2 */
+-8.12874355063065934246e+01,	/* C0545265, 57E4D2F2 */
+-9.81432934416914548592e+00,	/* C023A0EF, C69AC25C */
+ 1.96512716674392571292e+01,	/* 4033A6B9, BD707687 */
+ 1.37657754143519042600e+02,	/* 4061350C, 526AE721 */
+ 4.34565877475229228821e+02,	/* 407B290D, D58A1A71 */
+ 6.45387271733267880336e+02,	/* 40842B19, 21EC2868 */
+ 4.29008140027567833386e+02,	/* 407AD021, 57700314 */
+ 1.08635005541779435134e+02,	/* 405B28A3, EE48AE2C */
+ 6.57024977031928170135e+00,	/* 401A47EF, 8E484A93 */
+-6.04244152148580987438e-02,	/* BFAEEFF2, EE749A62 */
+/* [1/0.35, 28]: p0 ... p7, q1 ... q8 */
+-9.86494292470009928597e-03,	/* BF843412, 39E86F4A */
+-7.99283237680523006574e-01,	/* BFE993BA, 70C285DE */
+-1.77579549177547519889e+01,	/* C031C209, 555F995A */
+-1.60636384855821916062e+02,	/* C064145D, 43C5ED98 */
+-6.37566443368389627722e+02,	/* C083EC88, 1375F228 */
+-1.02509513161107724954e+03,	/* C0900461, 6A2E5992 */
+-4.83519191608651397019e+02,	/* C07E384E, 9BDC383F */
+ 0.0,
+ 3.03380607434824582924e+01,	/* 403E568B, 261D5190 */
+ 3.25792512996573918826e+02,	/* 40745CAE, 221B9F0A */
+ 1.53672958608443695994e+03,	/* 409802EB, 189D5118 */
+ 3.19985821950859553908e+03,	/* 40A8FFB7, 688C246A */
+ 2.55305040643316442583e+03,	/* 40A3F219, CEDF3BE6 */
+ 4.74528541206955367215e+02,	/* 407DA874, E79FE763 */
+-2.24409524465858183362e+01,	/* C03670E2, 42712D62 */
+ 0.0,
+/* u, masks */
+ 1.0,  0.0,  0.0,  0.0,  1.0,  0.0,  1.0,  0.0,
+ 0.0,  1.0, -1.0,  0.0,  1.0,  0.0,  0.0,  0.0,
+ 0.0,  0.0,  1.0,  1.0,  0.0,  1.0,  0.0,  0.0,
+ 0.0,  0.0,  1.0,  1.0,  0.0,  1.0,  0.0,  0.0,
+/* 2^(j/32) */
+ 1.00000000000000000000e+00, 0.00000000000000000000e+00,
+ 1.02189714865411662714e+00, 5.10922502897344389359e-17,
+ 1.04427378242741375480e+00, 8.55188970553796489217e-17,
+ 1.06714040067682369717e+00, -7.89985396684158212226e-17,
+ 1.09050773266525768967e+00, -3.04678207981247114697e-17,
+ 1.11438674259589243221e+00, 1.04102784568455709549e-16,
+ 1.13878863475669156458e+00, 8.91281267602540777782e-17,
+ 1.16372485877757747552e+00, 3.82920483692409349872e-17,
+ 1.18920711500272102690e+00, 3.98201523146564611098e-17,
+ 1.21524735998046895524e+00, -7.71263069268148813091e-17,
+ 1.24185781207348400201e+00, 4.65802759183693679123e-17,
+ 1.26905095719173321989e+00, 2.66793213134218609523e-18,
+ 1.29683955465100964055e+00, 2.53825027948883149593e-17,
+ 1.32523664315974132322e+00, -2.85873121003886137327e-17,
+ 1.35425554693689265129e+00, 7.70094837980298946162e-17,
+ 1.38390988196383202258e+00, -6.77051165879478628716e-17,
+ 1.41421356237309514547e+00, -9.66729331345291345105e-17,
+ 1.44518080697704665027e+00, -3.02375813499398731940e-17,
+ 1.47682614593949934623e+00, -3.48399455689279579579e-17,
+ 1.50916442759342284141e+00, -1.01645532775429503911e-16,
+ 1.54221082540794074411e+00, 7.94983480969762085616e-17,
+ 1.57598084510788649659e+00, -1.01369164712783039808e-17,
+ 1.61049033194925428347e+00, 2.47071925697978878522e-17,
+ 1.64575547815396494578e+00, -1.01256799136747726038e-16,
+ 1.68179283050742900407e+00, 8.19901002058149652013e-17,
+ 1.71861929812247793414e+00, -1.85138041826311098821e-17,
+ 1.75625216037329945351e+00, 2.96014069544887330703e-17,
+ 1.79470907500310716820e+00, 1.82274584279120867698e-17,
+ 1.83400808640934243066e+00, 3.28310722424562720351e-17,
+ 1.87416763411029996256e+00, -6.12276341300414256164e-17,
+ 1.91520656139714740007e+00, -1.06199460561959626376e-16,
+ 1.95714412417540017941e+00, 8.96076779103666776760e-17,
+};
@@ -0,0 +1,111 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vacosh: double precision vector acosh
+ *
+ * Algorithm:
+ *
+ * As in acosh.c, acosh(x) = log1p(t+sqrt(t*t+2*t)) with t = x-1, which
+ * is exact for 1 <= x <= 2.  The log1p arguments of a block of NBLK
+ * elements are formed in a buffer small enough to stay in cache and
+ * passed to __vlog1p.  For x >= 2^60 (and +Inf and NaN), x itself is
+ * passed and ln2 added to the logarithm, since then log1p(x) = log(x)
+ * to working precision.
+ *
+ * x < 1 gives a NaN and raises invalid without leaving the loop;
+ * unlike acosh(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 2.2 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern void __vlog1p(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double C[] = {
+	1.0,
+	0.0,
+	6.93147180559945286227e-01,	/* ln2 3FE62E42, FEFA39EF */
+};
+
+#define	one	C[0]
+#define	zero	C[1]
+#define	ln2	C[2]
+
+void
+__vacosh(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		a[NBLK], c[NBLK];
+	double		t;
+	int		i, j, m, hx;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			c[i] = zero;
+			if (hx >= 0x43b00000) { /* x >= 2^60, +inf or nan */
+				a[i] = t;
+				c[i] = ln2;
+			} else if (hx >= 0x3ff00000) { /* 1 <= x < 2^60 */
+				t -= one;
+				a[i] = t + sqrt(t * t + (t + t));
+			} else { /* x < 1 or nan */
+				a[i] = (t - t) / (t - t);
+			}
+		}
+		__vlog1p(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = a[i] + c[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -0,0 +1,89 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vacoshf: single precision vector acosh
+ *
+ * Algorithm:
+ *
+ * Work in double precision, where t = x-1 is exact and t*t cannot
+ * overflow, and form acosh(x) = log1p(t+sqrt(t*t+2*t)) for every x >=
+ * 1.  The log1p arguments of a block of NBLK elements are formed in a
+ * buffer small enough to stay in cache and passed to __vlog1p, whose
+ * error is far below a float ulp.
+ *
+ * x < 1 gives a NaN and raises invalid without leaving the loop;
+ * unlike acoshf(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.501 ulp for the whole
+ * float type range.
+ */
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern void __vlog1p(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double one = 1.0;
+
+void
+__vacoshf(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	double		a[NBLK];
+	double		t;
+	float		f;
+	int		i, j, m;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			f = x[j];
+			if (*(int *)&f >= 0x3f800000) { /* x >= 1, +inf or nan */
+				t = (double)f - one;
+				a[i] = t + sqrt(t * t + (t + t));
+			} else { /* x < 1 or nan */
+				a[i] = (f - f) / (f - f);
+			}
+		}
+		__vlog1p(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = (float)a[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
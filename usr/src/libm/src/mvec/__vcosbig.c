@@ -43,12 +43,10 @@
 #endif
 
 extern const double __vlibm_TBL_sincos_hi[], __vlibm_TBL_sincos_lo[];
-extern int __vlibm_rem_pio2m( double *, double *, int, int, int );
+extern int __vlibm_rem_pio2i( double, double * );
 
 static const double
-	zero	= 0.0,
 	one		= 1.0,
-	two24	= 16777216.0,
 	pp1		= -1.666666666605760465276263943134982554676e-0001,
 	pp2		=  8.333261209690963126718376566146180944442e-0003,
 	p1		= -1.666666666666629669805215138920301589656e-0001,
@@ -68,34 +66,16 @@ __vlibm_vcos_big( int n, double * restrict x, int stridex, double * restrict y,
 {
 	for ( ; n--; x += stridex, y += stridey )
 	{
-		double		tx, tt[3], ty[2], t, w, z, a;
+		double		ty[2], t, w, z, a;
 		unsigned	hx, xsb;
-		int			e0, nx, i, j;
+		int			nx, i, j;
 
 		hx = HI(x);
 		xsb = hx & 0x80000000;
 		hx &= ~0x80000000;
 		if ( hx <= thresh || hx >= 0x7ff00000 )
 			continue;
-		e0 = ( hx >> 20 ) - 1046;
-		HI(&tx) = 0x41600000 | ( hx & 0xfffff );
-		LO(&tx) = LO(x);
-		tt[0] = (double)( (int) tx );
-		tx = ( tx - tt[0] ) * two24;
-		if ( tx != zero )
-		{
-			nx = 2;
-			tt[1] = (double)( (int) tx );
-			tt[2] = ( tx - tt[1] ) * two24;
-			if ( tt[2] != zero )
-				nx = 3;
-		}
-		else
-		{
-			nx = 1;
-			tt[1] = tt[2] = zero;
-		}
-		nx = __vlibm_rem_pio2m( tt, ty, e0, nx, 2 );
+		nx = __vlibm_rem_pio2i( *x, ty );
 		if ( xsb )
 		{
 			nx = -nx;
@@ -0,0 +1,197 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __verfc: double precision vector erfc
+ *
+ * Algorithm:
+ *
+ * The approximations of erf.c, evaluated without branching on the
+ * interval.  For |x| in [0, 0.84375), [0.84375, 1.25), [1.25, 1/0.35)
+ * and [1/0.35, 28], erf.c uses a rational function p(u)/q(u) with u =
+ * x*x, |x|-1, 1/(x*x) and 1/(x*x) respectively.  The interval number k
+ * is formed from the high word of x with integer compares, and u, the
+ * coefficients of p and q (padded to a common degree) and the masks
+ * that select how the result is assembled are all looked up in
+ * __vlibm_TBL_erf by k, so a vector whose elements fall in different
+ * intervals runs through the same instructions with no mispredicted
+ * branches.
+ *
+ * On the last two intervals erfc(|x|) = exp(-x*x-0.5625+p/q)/|x|.  The
+ * exponential is computed in line for every element (with argument 0
+ * where it is masked off): -x*x is split as -s*s+(s-x)*(s+x) with s =
+ * x chopped to 21 bits as in erf.c, so that -s*s-0.5625 is exact, and
+ * the sum is reduced by multiples of ln2/32 with 2^(j/32) taken from
+ * the table.  The power of two is applied in two steps so that results
+ * down to the subnormal range are rounded once.
+ *
+ * The final value is add[i]+mul[i]*((m*x-sub[i])+(m*x+(1-m))*r), where
+ * i combines k, the sign of x and whether |x| >= 1/4, m = 1 on the
+ * first interval only and r is p/q or the exponential term; with the
+ * entries of add, mul and sub these reproduce the formulas of erfc()
+ * for each case.  |x| > 28 is treated as 28, whose erfc underflows.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 2.6 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern const double __vlibm_TBL_erf[];
+
+static const double C[] = {
+	1.0,
+	0.5,
+	5.625e-01,
+	4.61662413084468283841e+01,	/* 32/ln2 */
+	2.16608493865351192653e-02,	/* ln2/32 hi 3F962E42, FEE00000 */
+	5.96317165397058656257e-12,	/* ln2/32 lo */
+	6755399441055744.0,		/* 3*2^51 */
+	1.66666666666666666667e-01,	/* 1/3! */
+	4.16666666666666666667e-02,	/* 1/4! */
+	8.33333333333333333333e-03,	/* 1/5! */
+	1.38888888888888888889e-03,	/* 1/6! */
+};
+
+#define	one	C[0]
+#define	half	C[1]
+#define	c0_5625	C[2]
+#define	invln2_32	C[3]
+#define	ln2_32hi	C[4]
+#define	ln2_32lo	C[5]
+#define	magic	C[6]
+#define	E3	C[7]
+#define	E4	C[8]
+#define	E5	C[9]
+#define	E6	C[10]
+
+/*
+ * i = (k << 2) | (sign(x) << 1) | (|x| >= 1/4)
+ */
+static const double add[] = {
+	1.0, 0.5, 1.0, 1.0,
+	1.54937088489532470703e-01, 1.54937088489532470703e-01,	/* 1-erx */
+	1.84506291151046752930e+00, 1.84506291151046752930e+00,	/* 1+erx */
+	0.0, 0.0, 2.0, 2.0,
+	0.0, 0.0, 2.0, 2.0,
+};
+
+static const double mul[] = {
+	-1.0, -1.0, -1.0, -1.0,
+	-1.0, -1.0, 1.0, 1.0,
+	1.0, 1.0, -1.0, -1.0,
+	1.0, 1.0, -1.0, -1.0,
+};
+
+static const double sub[] = {
+	0.0, 0.5, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+};
+
+void
+__verfc(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*c, *u;
+	double		t, ax, s, z, v, p, q, h, l, w, e, r, sc0, sc1;
+	int		hx, ix, i, j, k, m;
+
+	LO(&sc0) = 0;
+	LO(&sc1) = 0;
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		t = *x;
+		hx = HI(&t);
+		ix = hx & 0x7fffffff;
+		if (ix >= 0x403c0000) { /* |x| >= 28, inf or nan */
+			if (ix >= 0x7ff00000) {
+				*y = (double)(((unsigned)hx >> 31) << 1) +
+				    one / t;
+				continue;
+			}
+			HI(&t) = (hx & 0x80000000) | 0x403c0000;
+			LO(&t) = 0;
+			ix = 0x403c0000;
+		}
+		ax = t;
+		HI(&ax) = ix;
+
+		k = (ix >= 0x3feb0000) + (ix >= 0x3ff40000) +
+		    (ix >= 0x4006db6e);
+		i = (k << 2) | (((unsigned)hx >> 31) << 1) |
+		    (ix >= 0x3fd00000);
+		c = __vlibm_TBL_erf + (k << 4);
+		u = __vlibm_TBL_erf + 64 + (k << 3);
+
+		/* p/q of erf.c at u = x*x, |x|-1 or 1/(x*x) */
+		z = t * t;
+		v = (u[0] * z + (u[1] * ax + u[2])) / (u[3] * z + u[4]);
+		p = c[0] + v * (c[1] + v * (c[2] + v * (c[3] + v * (c[4] +
+		    v * (c[5] + v * (c[6] + v * c[7]))))));
+		q = one + v * (c[8] + v * (c[9] + v * (c[10] + v * (c[11] +
+		    v * (c[12] + v * (c[13] + v * (c[14] + v * c[15])))))));
+		p = p / q;
+
+		/* r = exp(-x*x-0.5625+p/q)/|x| where u[5] = 1 */
+		s = ax;
+		LO(&s) = 0;
+		h = u[5] * (-(s * s) - c0_5625);
+		l = u[5] * ((s - ax) * (s + ax) + p);
+		w = (h + l) * invln2_32 + magic;
+		j = LO(&w);
+		w -= magic;
+		r = (h - w * ln2_32hi) + (l - w * ln2_32lo);
+		m = j >> 5;
+		j = (j & 31) << 1;
+		e = r * r * (half + r * (E3 + r * (E4 + r * (E5 +
+		    r * E6)))) + r;
+		e = __vlibm_TBL_erf[96+j] + (__vlibm_TBL_erf[97+j] +
+		    __vlibm_TBL_erf[96+j] * e);
+		HI(&sc0) = ((m >> 1) + 0x3ff) << 20;
+		HI(&sc1) = ((m - (m >> 1)) + 0x3ff) << 20;
+		r = ((e * sc0) / (ax + (one - u[5]))) * sc1;
+		r = (one - u[5]) * p + u[5] * r;
+
+		v = u[6] * t;
+		*y = add[i] + mul[i] * ((v - sub[i]) + (v + (one - u[6])) * r);
+	}
+}
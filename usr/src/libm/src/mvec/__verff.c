@@ -0,0 +1,156 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __verff: single precision vector erf
+ *
+ * Algorithm:
+ *
+ * Work in double precision with the interval selection and tables of
+ * __verf.  x*x is exact in double, so the argument of the exponential
+ * needs no splitting, and a degree 4 polynomial with 2^(j/32) from the
+ * table is accurate enough.  |x| > 11 is treated as 11, whose erf
+ * rounds to 1.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.501 ulp for the whole
+ * float type range.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern const double __vlibm_TBL_erf[];
+
+static const double C[] = {
+	1.0,
+	0.5,
+	5.625e-01,
+	4.61662413084468283841e+01,	/* 32/ln2 */
+	2.16608493924982901946e-02,	/* ln2/32 */
+	6755399441055744.0,		/* 3*2^51 */
+	1.66666666666666666667e-01,	/* 1/3! */
+	4.16666666666666666667e-02,	/* 1/4! */
+	11.0,
+};
+
+#define	one	C[0]
+#define	half	C[1]
+#define	c0_5625	C[2]
+#define	invln2_32	C[3]
+#define	ln2_32	C[4]
+#define	magic	C[5]
+#define	E3	C[6]
+#define	E4	C[7]
+#define	xmax	C[8]
+
+/*
+ * i = (k << 1) | sign(x)
+ */
+static const double add[] = {
+	0.0, -0.0,
+	8.45062911510467529297e-01, -8.45062911510467529297e-01, /* erx */
+	1.0, -1.0,
+	1.0, -1.0,
+};
+
+static const double mul[] = {
+	1.0, -1.0,
+	1.0, -1.0,
+	-1.0, 1.0,
+	-1.0, 1.0,
+};
+
+void
+__verff(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	const double	*c, *u;
+	double		t, ax, z, v, p, q, w, e, r, sc;
+	float		f;
+	int		hx, ix, i, j, k;
+
+	LO(&sc) = 0;
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		f = *x;
+		hx = *(int *)x;
+		if ((hx & 0x7fffffff) >= 0x7f800000) { /* inf or nan */
+			i = ((unsigned)hx >> 31) << 1;
+			*y = (float)(1 - i) + 1.0f / f;
+			continue;
+		}
+		t = (double)f;
+		if ((hx & 0x7fffffff) >= 0x41300000) /* |x| >= 11 */
+			t = (hx < 0)? -xmax : xmax;
+		ix = HI(&t) & 0x7fffffff;
+		ax = t;
+		HI(&ax) = ix;
+
+		k = (ix >= 0x3feb0000) + (ix >= 0x3ff40000) +
+		    (ix >= 0x4006db6e);
+		i = (k << 1) | ((unsigned)hx >> 31);
+		c = __vlibm_TBL_erf + (k << 4);
+		u = __vlibm_TBL_erf + 64 + (k << 3);
+
+		z = t * t;
+		v = (u[0] * z + (u[1] * ax + u[2])) / (u[3] * z + u[4]);
+		p = c[0] + v * (c[1] + v * (c[2] + v * (c[3] + v * (c[4] +
+		    v * (c[5] + v * (c[6] + v * c[7]))))));
+		q = one + v * (c[8] + v * (c[9] + v * (c[10] + v * (c[11] +
+		    v * (c[12] + v * (c[13] + v * (c[14] + v * c[15])))))));
+		p = p / q;
+
+		/* r = exp(-x*x-0.5625+p/q)/|x| where u[5] = 1 */
+		r = u[5] * ((-z - c0_5625) + p);
+		w = r * invln2_32 + magic;
+		j = LO(&w);
+		w -= magic;
+		r -= w * ln2_32;
+		HI(&sc) = ((j >> 5) + 0x3ff) << 20;
+		j = (j & 31) << 1;
+		e = __vlibm_TBL_erf[96+j] * (one + r * (one + r * (half +
+		    r * (E3 + r * E4))));
+		r = (e * sc) / (ax + (one - u[5]));
+		r = (one - u[5]) * p + u[5] * r;
+
+		v = u[6] * ax;
+		*y = (float)(add[i] + mul[i] * (v + (v + (one - u[6])) * r));
+	}
+}
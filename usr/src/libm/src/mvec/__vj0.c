@@ -0,0 +1,241 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vj0: double precision vector Bessel function j0
+ *
+ * Algorithm:
+ *
+ * As in j0.c: rational approximations in x*x for |x| <= 8, and for
+ * |x| > 8 the asymptotic form
+ *
+ *	j0(x) = (P(0,x)*cc - Q(0,x)*ss) / sqrt(pi*x),
+ *	cc = sin(x) + cos(x), ss = sin(x) - cos(x),
+ *
+ * where the smaller of cc and ss is recomputed as -cos(2x) divided by
+ * the other to avoid cancellation.  The large arguments of a block of
+ * NBLK elements are gathered into a buffer small enough to stay in
+ * cache, and their sines and cosines taken with one call to __vsincos
+ * and the cosines of their doubles with one call to __vcos, so no
+ * element calls a scalar sin or cos.
+ *
+ * Unlike j0(), no error handler is called for |x| > X_TLOSS.
+ *
+ * Accuracy:
+ *
+ * The same as j0(): the error is small in absolute terms, but the
+ * relative error is large close to the zeros of j0.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern const double __vlibm_TBL_bessel[];
+extern void __vsincos(int, double *, int, double *, int, double *, int);
+extern void __vcos(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+/* j0(x) = 1 + z*r/s, z = x*x, on [1.e-5, 1.28] */
+static const double r0[4] = {
+	-2.500000000000003622131880894830476755537e-0001,
+	1.095597547334830263234433855932375353303e-0002,
+	-1.819734750463320921799187258987098087697e-0004,
+	9.977001946806131657544212501069893930846e-0007,
+};
+
+static const double s0[4] = {
+	1.0,
+	1.867609810662950169966782360588199673741e-0002,
+	1.590389206181565490878430827706972074208e-0004,
+	6.520867386742583632375520147714499522721e-0007,
+};
+
+/* j0(x) = r/s, z = x*x, on [1.28, 8] */
+static const double r1[9] = {
+	9.999999999999999942156495584397047660949e-0001,
+	-2.389887722731319130476839836908143731281e-0001,
+	1.293359476138939027791270393439493640570e-0002,
+	-2.770985642343140122168852400228563364082e-0004,
+	2.905241575772067678086738389169625218912e-0006,
+	-1.636846356264052597969042009265043251279e-0008,
+	5.072306160724884775085431059052611737827e-0011,
+	-8.187060730684066824228914775146536139112e-0014,
+	5.422219326959949863954297860723723423842e-0017,
+};
+
+static const double s1[9] = {
+	1.0,
+	1.101122772686807702762104741932076228349e-0002,
+	6.140169310641649223411427764669143978228e-0005,
+	2.292035877515152097976946119293215705250e-0007,
+	6.356910426504644334558832036362219583789e-0010,
+	1.366626326900219555045096999553948891401e-0012,
+	2.280399586866739522891837985560481180088e-0015,
+	2.801559820648939665270492520004836611187e-0018,
+	2.073101088320349159764410261466350732968e-0021,
+};
+
+static const double C[] = {
+	0.0,
+	1.0,
+	8.0,
+	0.25,
+	-0.125,
+	1.0e-5,
+	1.0e-18,
+	1.28,
+	1.0e10,
+	1.0e40,
+	8.9e307,
+	5.641895835477562869480794515607725858441e-0001, /* 1/sqrt(pi) */
+};
+
+#define	zero		C[0]
+#define	one		C[1]
+#define	eight		C[2]
+#define	quarter		C[3]
+#define	meighth		C[4]
+#define	small		C[5]
+#define	tiny		C[6]
+#define	r1_28		C[7]
+#define	huge		C[8]
+#define	big		C[9]
+#define	ovfl2		C[10]
+#define	invsqrtpi	C[11]
+
+void
+__vj0(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*T = __vlibm_TBL_bessel;
+	double		r[NBLK], xs[NBLK], x2[NBLK], sn[NBLK], cs[NBLK];
+	double		c2[NBLK];
+	double		t, z, w, p, q, u, v, s, c, ss, cc;
+	int		id[NBLK];
+	int		i, j, k, l, m, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = k = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			ix = HI(&t) & 0x7fffffff;
+			HI(&t) = ix;
+			if (ix >= 0x7ff00000) {	/* inf or nan */
+				r[i] = (ix > 0x7ff00000 || LO(&t) != 0)?
+				    t * t : zero;
+			} else if (t > eight) {
+				xs[k] = t;
+				x2[k] = (t > ovfl2)? zero : t + t;
+				id[k++] = i;
+			} else if (t <= small) {
+				r[i] = (t <= tiny)? one - t : one - t * t *
+				    quarter;
+			} else if (t <= r1_28) {
+				z = t * t;
+				p = r0[0] + z * (r0[1] + z * (r0[2] + z *
+				    r0[3]));
+				q = s0[0] + z * (s0[1] + z * (s0[2] + z *
+				    s0[3]));
+				r[i] = one + z * (p / q);
+			} else {
+				z = t * t;
+				p = r1[8];
+				q = s1[8];
+				for (l = 7; l >= 0; l--) {
+					p = p * z + r1[l];
+					q = q * z + s1[l];
+				}
+				r[i] = p / q;
+			}
+		}
+		if (k > 0) {
+			__vsincos(k, xs, 1, sn, 1, cs, 1);
+			__vcos(k, x2, 1, c2, 1);
+		}
+		for (i = 0; i < k; i++) {
+			t = xs[i];
+			s = sn[i];
+			c = cs[i];
+			if (t > ovfl2) {
+				ss = s - c;
+				cc = s + c;
+			} else if ((HI(&sn[i]) ^ HI(&cs[i])) < 0) {
+				ss = s - c;
+				cc = -c2[i] / ss;
+			} else {
+				cc = s + c;
+				ss = -c2[i] / cc;
+			}
+			if (t > big) {
+				r[id[i]] = (invsqrtpi * cc) / sqrt(t);
+				continue;
+			}
+			if (t > huge) {
+				u = one;
+				v = meighth / t;
+			} else {
+				w = eight / t;
+				z = w * w;
+				p = T[6];
+				q = T[14];
+				u = T[22];
+				v = T[30];
+				for (l = 5; l >= 0; l--) {
+					p = p * z + T[l];
+					q = q * z + T[8+l];
+					u = u * z + T[16+l];
+					v = v * z + T[24+l];
+				}
+				v = w * (u / v);
+				u = p / q;
+			}
+			r[id[i]] = invsqrtpi * (u * cc - v * ss) / sqrt(t);
+		}
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = r[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
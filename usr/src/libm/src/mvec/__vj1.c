@@ -0,0 +1,247 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vj1: double precision vector Bessel function j1
+ *
+ * Algorithm:
+ *
+ * As in j1.c: j1(-x) = -j1(x), rational approximations in x*x for
+ * |x| <= 8, and for |x| > 8 the asymptotic form
+ *
+ *	j1(|x|) = (P(1,x)*cc - Q(1,x)*ss) / sqrt(pi*|x|),
+ *	cc = sin(|x|) - cos(|x|), ss = -sin(|x|) - cos(|x|),
+ *
+ * where the smaller of cc and ss is recomputed as cos(2|x|) divided by
+ * the other to avoid cancellation.  As in __vj0, the sines and cosines
+ * for the large arguments of a block are taken with one call each to
+ * __vsincos and __vcos.
+ *
+ * Unlike j1(), no error handler is called for |x| > X_TLOSS.
+ *
+ * Accuracy:
+ *
+ * The same as j1(): the error is small in absolute terms, but the
+ * relative error is large close to the zeros of j1.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern const double __vlibm_TBL_bessel[];
+extern void __vsincos(int, double *, int, double *, int, double *, int);
+extern void __vcos(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+/* j1(x) = x/2 + x*z*r/s, z = x*x, on [1.e-5, 1.28) */
+static const double r0[4] = {
+	-6.250000000000002203053200981413218949548e-0002,
+	1.600998455640072901321605101981501263762e-0003,
+	-1.963888815948313758552511884390162864930e-0005,
+	8.263917341093549759781339713418201620998e-0008,
+};
+
+static const double s0[4] = {
+	1.0e0,
+	1.605069137643004242395356851797873766927e-0002,
+	1.149454623251299996428500249509098499383e-0004,
+	3.849701673735260970379681807910852327825e-0007,
+};
+
+/* j1(x) = x*r/s, z = x*x, on [1.28, 8] */
+static const double r1[12] = {
+	4.999999999999999995517408894340485471724e-0001,
+	-6.003825028120475684835384519945468075423e-0002,
+	2.301719899263321828388344461995355419832e-0003,
+	-4.208494869238892934859525221654040304068e-0005,
+	4.377745135188837783031540029700282443388e-0007,
+	-2.854106755678624335145364226735677754179e-0009,
+	1.234002865443952024332943901323798413689e-0011,
+	-3.645498437039791058951273508838177134310e-0014,
+	7.404320596071797459925377103787837414422e-0017,
+	-1.009457448277522275262808398517024439084e-0019,
+	8.520158355824819796968771418801019930585e-0023,
+	-3.458159926081163274483854614601091361424e-0026,
+};
+
+static const double s1[5] = {
+	1.0e0,
+	4.923499437590484879081138588998986303306e-0003,
+	1.054389489212184156499666953501976688452e-0005,
+	1.180768373106166527048240364872043816050e-0008,
+	5.942665743476099355323245707680648588540e-0012,
+};
+
+static const double C[] = {
+	0.0,
+	1.0,
+	-1.0,
+	8.0,
+	0.5,
+	0.125,
+	0.375,
+	1.0e-5,
+	1.0e-20,
+	1.28,
+	1.0e10,
+	1.0e40,
+	8.9e307,
+	5.641895835477562869480794515607725858441e-0001, /* 1/sqrt(pi) */
+};
+
+#define	zero		C[0]
+#define	one		C[1]
+#define	mone		C[2]
+#define	eight		C[3]
+#define	half		C[4]
+#define	eighth		C[5]
+#define	q3_8		C[6]
+#define	small		C[7]
+#define	tiny		C[8]
+#define	r1_28		C[9]
+#define	huge		C[10]
+#define	big		C[11]
+#define	ovfl2		C[12]
+#define	invsqrtpi	C[13]
+
+void
+__vj1(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*T = __vlibm_TBL_bessel + 32;
+	double		r[NBLK], sg[NBLK], xs[NBLK], x2[NBLK], sn[NBLK];
+	double		cs[NBLK], c2[NBLK];
+	double		t, z, w, p, q, u, v, s, c, ss, cc;
+	int		id[NBLK];
+	int		i, j, k, l, m, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = k = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			if (ix >= 0x7ff00000) {	/* inf or nan */
+				r[i] = one / t;
+				sg[i] = one;
+				continue;
+			}
+			HI(&t) = ix;
+			sg[i] = (hx < 0)? mone : one;
+			if (t > eight) {
+				xs[k] = t;
+				x2[k] = (t > ovfl2)? zero : t + t;
+				id[k++] = i;
+			} else if (t <= small) {
+				r[i] = (t <= tiny)? half * t : t * (half - t *
+				    t * eighth);
+			} else if (t < r1_28) {
+				z = t * t;
+				p = r0[3];
+				q = s0[3];
+				for (l = 2; l >= 0; l--) {
+					p = p * z + r0[l];
+					q = q * z + s0[l];
+				}
+				r[i] = t * half + t * (z * (p / q));
+			} else {
+				z = t * t;
+				p = r1[11];
+				for (l = 10; l >= 0; l--)
+					p = p * z + r1[l];
+				q = s1[0] + z * (s1[1] + z * (s1[2] + z *
+				    (s1[3] + z * s1[4])));
+				r[i] = t * (p / q);
+			}
+		}
+		if (k > 0) {
+			__vsincos(k, xs, 1, sn, 1, cs, 1);
+			__vcos(k, x2, 1, c2, 1);
+		}
+		for (i = 0; i < k; i++) {
+			t = xs[i];
+			s = sn[i];
+			c = cs[i];
+			if (t > ovfl2) {
+				ss = -s - c;
+				cc = s - c;
+			} else if ((HI(&sn[i]) ^ HI(&cs[i])) < 0) {
+				cc = s - c;
+				ss = c2[i] / cc;
+			} else {
+				ss = -s - c;
+				cc = c2[i] / ss;
+			}
+			if (t > big) {
+				r[id[i]] = (invsqrtpi * cc) / sqrt(t);
+				continue;
+			}
+			if (t > huge) {
+				u = one;
+				v = q3_8 / t;
+			} else {
+				w = eight / t;
+				z = w * w;
+				p = T[6];
+				q = T[14];
+				u = T[22];
+				v = T[30];
+				for (l = 5; l >= 0; l--) {
+					p = p * z + T[l];
+					q = q * z + T[8+l];
+					u = u * z + T[16+l];
+					v = v * z + T[24+l];
+				}
+				v = w * (u / v);
+				u = p / q;
+			}
+			r[id[i]] = invsqrtpi * (u * cc - v * ss) / sqrt(t);
+		}
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = sg[i] * r[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
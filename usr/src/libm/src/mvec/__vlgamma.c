@@ -0,0 +1,345 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vlgamma: double precision vector lgamma with optional sign array
+ *
+ * void __vlgamma(int n, double *x, int stridex, double *y, int stridey,
+ *     int *s, int strides);
+ *
+ * y[i] = lgamma(x[i]), and if s is not NULL, s[i] is the sign of
+ * gamma(x[i]) (+1 or -1), as lgamma_r() would store.
+ *
+ * Algorithm:
+ *
+ * The approximations of __lgamma.c (Cody's rational functions on
+ * (0, 12] and Stirling's series beyond), with the logarithms they
+ * need taken out of the loop: the log arguments of a block of NBLK
+ * elements are formed in a buffer small enough to stay in cache and
+ * passed to __vlog, so positive arguments go through straight line
+ * code with no calls.
+ *
+ * For x < 0, lgamma(x) = -log(|sin(pi*x)|*|x|/pi) - lgamma(|x|).  |x|
+ * is reduced to d = |x|-k, k = rint(|x|), exactly, and sin(pi*d) is
+ * taken from __vsin for the negative elements of the block only.  For
+ * |x| < 0.6796875 the -log(|x|) term of lgamma(|x|) cancels against
+ * the factor |x|, so it is left out of both and tiny |x| do not
+ * underflow.
+ *
+ * lgamma(+-0) and lgamma(-n) are +Inf, with sign +1 and divide-by-zero
+ * raised; lgamma(+-Inf) is +Inf and lgamma(NaN) is NaN.  Unlike
+ * lgamma(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * The same as lgamma(), whose rational approximations these are: less
+ * than 7 ulp observed for x > 0.  For x < 0 the absolute error is small
+ * but, as for lgamma(), the relative error is large close to the zeros
+ * of lgamma.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern void __vlog(int, double *, int, double *, int);
+extern void __vsin(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+static const double C[] = {
+	1.0,
+	0.0,
+	0.5,
+	2.0,
+	4.0,
+	0.6796875,
+	1.5,
+	12.0,
+	1.0e17,
+	4503599627370496.0,		/* 2^52 */
+	3.14159265358979311600e+00,	/* pi */
+	3.18309886183790671538e-01,	/* 1/pi */
+	9.18938533204672741780e-01,	/* log(2*pi)/2 */
+	-5.772156649015328605195174e-1,	/* D1 */
+	4.227843350984671393993777e-1,	/* D2 */
+	1.791759469228055000094023e0,	/* D4 */
+};
+
+#define	one	C[0]
+#define	zero	C[1]
+#define	half	C[2]
+#define	two	C[3]
+#define	four	C[4]
+#define	c0_68	C[5]
+#define	c1_5	C[6]
+#define	twelve	C[7]
+#define	big	C[8]
+#define	two52	C[9]
+#define	pi	C[10]
+#define	invpi	C[11]
+#define	hln2pi	C[12]
+#define	D1	C[13]
+#define	D2	C[14]
+#define	D4	C[15]
+
+/* P/Q over (0.5, 1.5) */
+static const double p[] = {
+	7.225813979700288197698961e3,
+	2.637748787624195437963534e4,
+	3.848496228443793359990269e4,
+	2.855724635671635335736389e4,
+	1.131967205903380828685045e4,
+	2.290838373831346393026739e3,
+	2.018112620856775083915565e2,
+	4.945235359296727046734888e0,
+};
+
+static const double q[] = {
+	8.785536302431013170870835e3,
+	3.635127591501940507276287e4,
+	6.161122180066002127833352e4,
+	5.499310206226157329794414e4,
+	2.763987074403340708898585e4,
+	7.738757056935398733233834e3,
+	1.113332393857199323513008e3,
+	6.748212550303777196073036e1,
+};
+
+/* G/H over (1.5, 4.0) */
+static const double g[] = {
+	3.074109054850539556250927e6,
+	5.106661678927352456275255e6,
+	3.338152967987029735917223e6,
+	1.088204769468828767498470e6,
+	1.847932904445632425417223e5,
+	1.550693864978364947665077e4,
+	5.424138599891070494101986e2,
+	4.974607845568932035012064e0,
+};
+
+static const double h[] = {
+	9.533095591844353613395747e6,
+	1.782736530353274213975932e7,
+	1.346701454311101692290052e7,
+	5.267964117437946917577538e6,
+	1.136705821321969608938755e6,
+	1.331903827966074194402448e5,
+	7.765049321445005871323047e3,
+	1.830328399370592604055942e2,
+};
+
+/* U/V over (4.0, 12.0) */
+static const double u[] = {
+	5.606251856223951465078242e11,
+	4.926125793377430887588120e11,
+	1.702665737765398868392998e11,
+	2.940378956634553899906876e10,
+	2.663432449630976949898078e9,
+	1.214755574045093227939592e8,
+	2.426813369486704502836312e6,
+	1.474502166059939948905062e4,
+};
+
+static const double v[] = {
+	4.463158187419713286462081e11,
+	3.417476345507377132798597e11,
+	1.016803586272438228077304e11,
+	1.488613728678813811542398e10,
+	1.120872109616147941376570e9,
+	4.135599930241388052042842e7,
+	6.393885654300092398984238e5,
+	2.690530175870899333379843e3,
+};
+
+/* Stirling's series over (12, Inf) */
+static const double c[] = {
+	8.333333333333333331554247e-02,
+	-2.777777777777681622553e-03,
+	7.93650793500350248e-04,
+	-5.952379913043012e-04,
+	8.4171387781295e-04,
+	-1.910444077728e-03,
+	5.7083835261e-03,
+};
+
+void
+__vlgamma(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey, int *restrict s, int strides)
+{
+	double		a[NBLK], la[NBLK], r[NBLK], sb[NBLK];
+	int		cl[NBLK], ni[NBLK];
+	double		t, w, z, cr, pp, qq;
+	int		i, j, k, m, ns, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		ns = 0;
+		for (i = j = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			HI(&t) = ix;
+			a[i] = t;
+			la[i] = t;
+			cl[i] = 0;
+			if (ix >= 0x7ff00000) { /* inf or nan */
+				r[i] = t * t;
+				cl[i] = 1;
+			} else if ((ix | LO(&t)) == 0) { /* +-0 */
+				r[i] = one / zero;
+				cl[i] = 1;
+			} else if (hx < 0) {
+				/* d = |x|-rint(|x|), k = rint(|x|) mod 2 */
+				w = t + two52;
+				k = LO(&w) & 1;
+				w -= two52;
+				if (ix >= 0x43300000 || w == t) {
+					r[i] = one / zero;
+					cl[i] = 1;
+				} else {
+					sb[ns] = pi * (t - w);
+					ni[ns++] = i;
+					cl[i] = 2 + k;
+				}
+			}
+		}
+
+		/* log(|x|), and -log(|sin(pi*x)|*|x|/pi) for x < 0 */
+		__vlog(m, la, 1, la, 1);
+		if (ns > 0) {
+			__vsin(ns, sb, 1, sb, 1);
+			for (j = 0; j < ns; j++) {
+				i = ni[j];
+				t = sb[j];
+				/* gamma(x) > 0 iff sin(pi*|x|) < 0 */
+				if ((cl[i] == 2) == (t > zero))
+					cl[i] = 3;
+				else
+					cl[i] = 2;
+				t = ((t < zero)? -t : t) * invpi;
+				if (a[i] >= c0_68)
+					t *= a[i];
+				sb[j] = t;
+			}
+			__vlog(ns, sb, 1, sb, 1);
+			for (j = 0; j < ns; j++)
+				r[ni[j]] = -sb[j];
+		}
+
+		for (i = j = 0; i < m; i++, j += stridey) {
+			if (cl[i] == 1) {
+				y[j] = r[i];
+				if (s)
+					s[i * strides] = 1;
+				continue;
+			}
+			t = a[i];
+			cr = (cl[i] == 0)? -la[i] : zero;
+			if (t <= c1_5) {
+				if (t < c0_68) {
+					z = t;
+				} else {
+					cr = zero;
+					z = t - one;
+				}
+				if (t <= half || t >= c0_68) {
+					pp = p[0] + z * (p[1] + z * (p[2] +
+					    z * (p[3] + z * (p[4] + z * (p[5] +
+					    z * (p[6] + z * p[7]))))));
+					qq = q[0] + z * (q[1] + z * (q[2] +
+					    z * (q[3] + z * (q[4] + z * (q[5] +
+					    z * (q[6] + z * (q[7] + z)))))));
+					w = cr + z * (D1 + z * (pp / qq));
+				} else {
+					z = t - one;
+					pp = g[0] + z * (g[1] + z * (g[2] +
+					    z * (g[3] + z * (g[4] + z * (g[5] +
+					    z * (g[6] + z * g[7]))))));
+					qq = h[0] + z * (h[1] + z * (h[2] +
+					    z * (h[3] + z * (h[4] + z * (h[5] +
+					    z * (h[6] + z * (h[7] + z)))))));
+					w = cr + z * (D2 + z * (pp / qq));
+				}
+			} else if (t <= four) {
+				z = t - two;
+				pp = g[0] + z * (g[1] + z * (g[2] + z * (g[3] +
+				    z * (g[4] + z * (g[5] + z * (g[6] +
+				    z * g[7]))))));
+				qq = h[0] + z * (h[1] + z * (h[2] + z * (h[3] +
+				    z * (h[4] + z * (h[5] + z * (h[6] +
+				    z * (h[7] + z)))))));
+				w = z * (D2 + z * (pp / qq));
+			} else if (t <= twelve) {
+				z = t - four;
+				pp = u[0] + z * (u[1] + z * (u[2] + z * (u[3] +
+				    z * (u[4] + z * (u[5] + z * (u[6] +
+				    z * u[7]))))));
+				qq = v[0] + z * (v[1] + z * (v[2] + z * (v[3] +
+				    z * (v[4] + z * (v[5] + z * (v[6] +
+				    z * (v[7] - z)))))));
+				w = D4 + z * (pp / qq);
+			} else if (t <= big) {
+				w = one / t;
+				z = w * w;
+				pp = hln2pi + w * (c[0] + z * (c[1] + z * (c[2] +
+				    z * (c[3] + z * (c[4] + z * (c[5] +
+				    z * c[6]))))));
+				w = t * (la[i] - one) - (half * la[i] - pp);
+			} else {
+				w = t * (la[i] - one);
+			}
+
+			if (cl[i] == 0) {
+				y[j] = w;
+				if (s)
+					s[i * strides] = 1;
+			} else {
+				y[j] = r[i] - w;
+				if (s)
+					s[i * strides] = (cl[i] == 2)? 1 : -1;
+			}
+		}
+		x += m * stridex;
+		y += m * stridey;
+		if (s)
+			s += m * strides;
+		n -= m;
+	}
+}
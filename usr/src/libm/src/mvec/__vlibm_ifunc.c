@@ -0,0 +1,236 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * Run time selection of the x86 libmvec entry points.
+ *
+ * An entry point with more than one implementation is compiled
+ * once per instruction set under a suffixed name (the Makefiles
+ * pass -D__vexp=__vexp_sse2 and so on), and the public name is
+ * bound here to the best body the processor can run:
+ *
+ *	i386	__v*_x87, or __v*_sse2 if SSE2 is present
+ *	amd64	__v*_sse2, or __v*_avx2 if AVX2 and FMA are present
+ *
+ * AVX-512 bodies are deliberately out of scope: the wider vectors
+ * buy little for these loops, whose cost is in table lookups and
+ * special case handling, and on many processors they lower the
+ * clock of the whole core.  AVX-512 processors get the AVX2 bodies;
+ * __vlibm_isa() still reports ISA_AVX512 so that a tier can be
+ * added here if that ever changes.
+ *
+ * With the GNU toolchain each entry point is an indirect function:
+ * the dynamic linker calls the resolver once, when it relocates
+ * the first reference, and calls go straight to the chosen body.
+ * Other compilers get a stub that calls through a pointer, which
+ * starts out at the baseline body and is moved to the better one by
+ * an init section function when the library is loaded; a call made
+ * before that, from another object's init section, still works.
+ */
+
+#define	ISA_X87		0
+#define	ISA_SSE2	1
+#define	ISA_AVX2	2
+#define	ISA_AVX512	3
+
+extern int __vlibm_isa(void);
+
+#if defined(__amd64)
+
+#define	LO		sse2
+#define	HI		avx2
+#define	HI_ISA		ISA_AVX2
+
+#define	ENTRIES(X)				\
+	X(__vexp, U, double)			\
+	X(__vexpf, U, float)			\
+	X(__vpow, B, double)			\
+	X(__vpowf, B, float)
+
+#else
+
+#define	LO		x87
+#define	HI		sse2
+#define	HI_ISA		ISA_SSE2
+
+#define	ENTRIES(X)				\
+	X(__vacos, U, double)			\
+	X(__vacosf, U, float)			\
+	X(__vasin, U, double)			\
+	X(__vasinf, U, float)			\
+	X(__vacosh, U, double)			\
+	X(__vacoshf, U, float)			\
+	X(__vasinh, U, double)			\
+	X(__vasinhf, U, float)			\
+	X(__vatan, U, double)			\
+	X(__vatan2, B, double)			\
+	X(__vatan2f, B, float)			\
+	X(__vatan2pi, B, double)		\
+	X(__vatan2pif, B, float)		\
+	X(__vatanf, U, float)			\
+	X(__vatanh, U, double)			\
+	X(__vatanhf, U, float)			\
+	X(__vc_abs, U, float)			\
+	X(__vc_exp, E, float)			\
+	X(__vc_exp_fused, U, float)		\
+	X(__vc_log, U, float)			\
+	X(__vc_pow, P, float)			\
+	X(__vcbrt, U, double)			\
+	X(__vcbrtf, U, float)			\
+	X(__vcos, U, double)			\
+	X(__vcosf, U, float)			\
+	X(__vcosh, U, double)			\
+	X(__vcoshf, U, float)			\
+	X(__vcospi, U, double)			\
+	X(__vcospif, U, float)			\
+	X(__verf, U, double)			\
+	X(__verfc, U, double)			\
+	X(__verfcf, U, float)			\
+	X(__verff, U, float)			\
+	X(__vexp, U, double)			\
+	X(__vexp10, U, double)			\
+	X(__vexp10f, U, float)			\
+	X(__vexp2, U, double)			\
+	X(__vexp2f, U, float)			\
+	X(__vexpf, U, float)			\
+	X(__vexpm1, U, double)			\
+	X(__vexpm1f, U, float)			\
+	X(__vhypot, B, double)			\
+	X(__vhypotf, B, float)			\
+	X(__vj0, U, double)			\
+	X(__vj1, U, double)			\
+	X(__vlgamma, S, double)			\
+	X(__vlgammaf, S, float)			\
+	X(__vlog, U, double)			\
+	X(__vlog10, U, double)			\
+	X(__vlog10f, U, float)			\
+	X(__vlog1p, U, double)			\
+	X(__vlog1pf, U, float)			\
+	X(__vlog2, U, double)			\
+	X(__vlog2f, U, float)			\
+	X(__vlogf, U, float)			\
+	X(__vnormcdf, U, double)		\
+	X(__vnormcdff, U, float)		\
+	X(__vpow, B, double)			\
+	X(__vpowf, B, float)			\
+	X(__vrhypot, B, double)			\
+	X(__vrhypotf, B, float)			\
+	X(__vrsqrt, U, double)			\
+	X(__vrsqrtf, U, float)			\
+	X(__vsin, U, double)			\
+	X(__vsincos, B, double)			\
+	X(__vsincosf, B, float)			\
+	X(__vsincospi, B, double)		\
+	X(__vsincospif, B, float)		\
+	X(__vsinf, U, float)			\
+	X(__vsinh, U, double)			\
+	X(__vsinhf, U, float)			\
+	X(__vsinpi, U, double)			\
+	X(__vsinpif, U, float)			\
+	X(__vsqrt, U, double)			\
+	X(__vsqrtf, U, float)			\
+	X(__vtan, U, double)			\
+	X(__vtanf, U, float)			\
+	X(__vtanh, U, double)			\
+	X(__vtanhf, U, float)			\
+	X(__vtgamma, U, double)			\
+	X(__vtgammaf, U, float)			\
+	X(__vy0, U, double)			\
+	X(__vy1, U, double)			\
+	X(__vz_abs, U, double)			\
+	X(__vz_exp, E, double)			\
+	X(__vz_exp_fused, U, double)		\
+	X(__vz_log, U, double)			\
+	X(__vz_pow, P, double)
+
+#endif
+
+/*
+ * Parameter and argument lists of the five kinds of entry point:
+ * unary (__vexp), binary (__vpow), the complex exp and pow, which
+ * take a scratch array, and lgamma, which also returns an int sign.
+ */
+#define	U_PARMS(t)	(int n, t *x, int sx, t *y, int sy)
+#define	U_ARGS		(n, x, sx, y, sy)
+#define	B_PARMS(t)	(int n, t *x, int sx, t *y, int sy, t *z, int sz)
+#define	B_ARGS		(n, x, sx, y, sy, z, sz)
+#define	E_PARMS(t)	(int n, t *x, int sx, t *y, int sy, t *tmp)
+#define	E_ARGS		(n, x, sx, y, sy, tmp)
+#define	P_PARMS(t)	(int n, t *x, int sx, t *y, int sy, t *z, int sz, \
+			t *tmp)
+#define	P_ARGS		(n, x, sx, y, sy, z, sz, tmp)
+#define	S_PARMS(t)	(int n, t *x, int sx, t *y, int sy, int *s, int ss)
+#define	S_ARGS		(n, x, sx, y, sy, s, ss)
+
+#define	BODY(f, isa)	BODY_(f, isa)
+#define	BODY_(f, isa)	f##_##isa
+
+#define	DECLARE(f, k, t)					\
+	extern void BODY(f, LO) k##_PARMS(t);			\
+	extern void BODY(f, HI) k##_PARMS(t);
+
+ENTRIES(DECLARE)
+
+#if defined(__GNUC__)
+
+#define	DEFINE(f, k, t)						\
+	static __typeof__(&BODY(f, LO))				\
+	f##_resolve(void)					\
+	{							\
+		return ((__vlibm_isa() >= HI_ISA)?		\
+		    BODY(f, HI) : BODY(f, LO));			\
+	}							\
+	void f k##_PARMS(t) __attribute__((ifunc(#f "_resolve")));
+
+ENTRIES(DEFINE)
+
+#else
+
+#define	DEFINE(f, k, t)						\
+	static void (*f##_p) k##_PARMS(t) = BODY(f, LO);	\
+								\
+	void							\
+	f k##_PARMS(t)						\
+	{							\
+		(*f##_p) k##_ARGS;				\
+	}
+
+ENTRIES(DEFINE)
+
+#define	BIND(f, k, t)						\
+	f##_p = BODY(f, HI);
+
+static void
+__vlibm_ifunc_init(void)
+{
+	if (__vlibm_isa() >= HI_ISA) {
+		ENTRIES(BIND)
+	}
+}
+
+#pragma init(__vlibm_ifunc_init)
+
+#endif
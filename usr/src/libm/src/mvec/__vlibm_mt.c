@@ -0,0 +1,290 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * Thread pool for the Fortran vector wrappers.
+ *
+ * A call that is large enough is cut into at most one chunk per
+ * pool thread.  The descriptor goes on a queue from which idle
+ * workers take chunks; the calling thread takes chunks too, so a
+ * call always makes progress even when every worker is busy with
+ * other callers' work.  Chunk boundaries are placed so that, for
+ * small strides, each chunk of the output array begins on a cache
+ * line, keeping threads from writing to the same line.
+ *
+ * The pool is configured from the environment the first time it
+ * is used:
+ *
+ *	LIBMVEC_NUM_THREADS	threads per call, counting the caller
+ *				(default: number of online cpus; 1
+ *				disables the pool)
+ *	LIBMVEC_MT_THRESHOLD	smallest n worth splitting (default
+ *				VLIBM_MT_THRESHOLD)
+ *
+ * As with the serial functions, a worker runs in its own floating
+ * point environment.
+ */
+
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include "vlibm_mt.h"
+
+#define	VLIBM_MT_LINE		64	/* cache line size */
+#define	VLIBM_MT_MINCHUNK	256	/* fewest elements in a chunk */
+#define	VLIBM_MT_THRESHOLD	8192
+#define	VLIBM_MT_MAXTHREADS	64
+
+static pthread_once_t	once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t	lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	work = PTHREAD_COND_INITIALIZER;
+
+/* calls with chunks not yet handed out; protected by lock */
+static struct __vlibm_mt *head = NULL, *tail = NULL;
+
+static int	nthreads = 1;
+static int	threshold = VLIBM_MT_THRESHOLD;
+
+/* number of array arguments for each argument list shape */
+static const int nargs[] = { 2, 3, 3, 4 };
+
+/* index of the array whose chunks are aligned to cache lines */
+static const int outarg[] = { 1, 2, 1, 2 };
+
+static int
+envint(const char *name, int dflt)
+{
+	char	*s, *e;
+	long	v;
+
+	if ((s = getenv(name)) == NULL || *s == '\0')
+		return (dflt);
+	v = strtol(s, &e, 10);
+	if (*e != '\0' || v < 0 || v > INT_MAX)
+		return (dflt);
+	return ((int)v);
+}
+
+/*
+ * Run elements [lo, hi) of the call described by d
+ */
+static void
+run(struct __vlibm_mt *d, int lo, int hi)
+{
+	char	*a[VLIBM_MT_MAXARG];
+	int	i;
+
+	for (i = 0; i < nargs[d->kind]; i++)
+		a[i] = d->a[i] + (long)lo * d->s[i] * d->esz[i];
+
+	switch (d->kind) {
+	case VLIBM_MT_U:
+		(*d->fn)(hi - lo, a[0], d->s[0], a[1], d->s[1]);
+		break;
+
+	case VLIBM_MT_B:
+		(*d->fn)(hi - lo, a[0], d->s[0], a[1], d->s[1], a[2], d->s[2]);
+		break;
+
+	case VLIBM_MT_E:
+		(*d->fn)(hi - lo, a[0], d->s[0], a[1], d->s[1], a[2]);
+		break;
+
+	case VLIBM_MT_P:
+		(*d->fn)(hi - lo, a[0], d->s[0], a[1], d->s[1], a[2], d->s[2],
+		    a[3]);
+		break;
+	}
+}
+
+/*
+ * Return the first element of chunk k: the even split point rounded
+ * to the nearest element of the form first + j * unit
+ */
+static int
+bound(struct __vlibm_mt *d, int k)
+{
+	int	i;
+
+	if (k == 0)
+		return (0);
+	if (k == d->nchunk)
+		return (d->n);
+	i = (int)(((long long)d->n * k) / d->nchunk) - d->first;
+	return (d->first + ((i + (d->unit >> 1)) / d->unit) * d->unit);
+}
+
+/*
+ * Hand out the next chunk of d, dropping d from the queue once the
+ * last one is gone; called with lock held
+ */
+static int
+claim(struct __vlibm_mt *d)
+{
+	int	k;
+
+	k = d->claimed++;
+	if (d->claimed == d->nchunk) {
+		/* d is always at the head of the queue here */
+		head = d->next;
+		if (head == NULL)
+			tail = NULL;
+	}
+	return (k);
+}
+
+/*
+ * Take chunks from d until none are left; called with lock held
+ */
+static void
+help(struct __vlibm_mt *d)
+{
+	int	k;
+
+	while (d->claimed < d->nchunk) {
+		k = claim(d);
+		(void) pthread_mutex_unlock(&lock);
+		run(d, bound(d, k), bound(d, k + 1));
+		(void) pthread_mutex_lock(&lock);
+		if (++d->done == d->nchunk)
+			(void) pthread_cond_signal(&d->cv);
+	}
+}
+
+/* ARGSUSED */
+static void *
+worker(void *arg)
+{
+	(void) pthread_mutex_lock(&lock);
+	for (;;) {
+		while (head == NULL)
+			(void) pthread_cond_wait(&work, &lock);
+		help(head);
+	}
+	/* NOTREACHED */
+	return (NULL);
+}
+
+/*
+ * The workers do not survive fork; run serially in the child
+ */
+static void
+child(void)
+{
+	nthreads = 1;
+}
+
+static void
+init(void)
+{
+	pthread_attr_t	attr;
+	pthread_t	tid;
+	sigset_t	all, old;
+	long		ncpus;
+	int		i, n;
+
+	ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (ncpus < 1)
+		ncpus = 1;
+	n = envint("LIBMVEC_NUM_THREADS", (int)ncpus);
+	if (n > VLIBM_MT_MAXTHREADS)
+		n = VLIBM_MT_MAXTHREADS;
+	threshold = envint("LIBMVEC_MT_THRESHOLD", VLIBM_MT_THRESHOLD);
+	if (n < 2 || pthread_atfork(NULL, NULL, child) != 0)
+		return;
+
+	/* workers take no signals meant for the application */
+	(void) sigfillset(&all);
+	(void) pthread_sigmask(SIG_SETMASK, &all, &old);
+	(void) pthread_attr_init(&attr);
+	(void) pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	for (i = 1; i < n; i++)
+		if (pthread_create(&tid, &attr, worker, NULL) != 0)
+			break;
+	(void) pthread_attr_destroy(&attr);
+	(void) pthread_sigmask(SIG_SETMASK, &old, NULL);
+	nthreads = i;
+}
+
+void
+__vlibm_mt(struct __vlibm_mt *d)
+{
+	unsigned long	m;
+	int		o, sb;
+
+	(void) pthread_once(&once, init);
+	d->nchunk = d->n / VLIBM_MT_MINCHUNK;
+	if (d->nchunk > nthreads)
+		d->nchunk = nthreads;
+	if (d->n < threshold || d->nchunk < 2) {
+		run(d, 0, d->n);
+		return;
+	}
+
+	/*
+	 * If whole elements of the output array fit in a cache line,
+	 * start each chunk at an element that begins a line.
+	 */
+	d->unit = 1;
+	d->first = 0;
+	o = outarg[d->kind];
+	sb = d->esz[o] * (d->s[o] < 0 ? -d->s[o] : d->s[o]);
+	if (sb > 0 && sb < VLIBM_MT_LINE && VLIBM_MT_LINE % sb == 0) {
+		m = (unsigned long)d->a[o] & (VLIBM_MT_LINE - 1);
+		if (d->s[o] > 0)
+			m = (VLIBM_MT_LINE - m) & (VLIBM_MT_LINE - 1);
+		if (m % sb == 0) {
+			d->unit = VLIBM_MT_LINE / sb;
+			d->first = (int)m / sb;
+		}
+	}
+
+	d->claimed = d->done = 0;
+	d->next = NULL;
+	(void) pthread_cond_init(&d->cv, NULL);
+	(void) pthread_mutex_lock(&lock);
+	if (tail == NULL)
+		head = d;
+	else
+		tail->next = d;
+	tail = d;
+	for (o = 1; o < d->nchunk; o++)
+		(void) pthread_cond_signal(&work);
+
+	/* work on our own call, then wait for the workers to finish */
+	while (d->claimed < d->nchunk && head != d) {
+		/* calls queued ahead of ours are being served first */
+		help(head);
+	}
+	help(d);
+	while (d->done < d->nchunk)
+		(void) pthread_cond_wait(&d->cv, &lock);
+	(void) pthread_mutex_unlock(&lock);
+	(void) pthread_cond_destroy(&d->cv);
+}
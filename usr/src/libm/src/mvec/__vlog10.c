@@ -0,0 +1,786 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vlog10: double precision vector log10
+ *
+ * Algorithm:
+ *
+ * This is __vlog with the tables and coefficients rescaled by
+ * 1/log(10).  Write x = 2^n z where 1 - 2^-10 <= z < 2 - 2^-9.
+ * Let m = z rounded to nine significant bits, so m = 1 + 2^-8 k,
+ * where 0 <= k <= 255.  Let d = z - m.  Then
+ *
+ * log10(x) = n log10(2) + log10(m) + log10(1+(d/m))
+ *
+ * Let lg2hi = log10(2) rounded to a multiple of 2^-42 and lg2lo
+ * ~ log10(2) - lg2hi.  From a table, obtain mh and ml such that
+ * mh = log10(m) rounded to a multiple of 2^-42 and ml ~ log10(m)
+ * - mh.  From the same table, obtain rh and rl such that rh =
+ * 1/(m log(10)) rounded to ten significant bits and rl ~ 1/(m
+ * log(10)) - rh, so that d*rh is exact.  Let s = d*rh + d*rl in
+ * double precision; then log10(1+(d/m)) ~ s + p(s), where p(s)
+ * := s*s*(P2+s*(P3+s*(P4+s*(P5+s*P6)))) and Pj is the coefficient
+ * of the __vlog polynomial divided by log(10)^(j-1).  Now we can
+ * compute the sum above accurately as
+ *
+ * (n*lg2hi + mh) + (d*rh + (d*rl + (n*lg2lo + ml) + p(s)))
+ *
+ * When x is subnormal, we first scale it to the normal range,
+ * adjusting n accordingly.
+ *
+ * Accuracy:
+ *
+ * The largest error observed is less than 0.76 ulps.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)&x)
+#define	LO(x)	*(unsigned *)&x
+#define	HIWORD	1
+#define	LOWORD	0
+#else
+#define	HI(x)	*(int *)&x
+#define	LO(x)	*(1+(unsigned *)&x)
+#define	HIWORD	0
+#define	LOWORD	1
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+static const double TBL[] = {
+	4.34082031250000000000e-01,  2.12450653251827645479e-04,
+	0.00000000000000000000e+00,  0.00000000000000000000e+00,
+	4.32617187500000000000e-01, -1.25673940370899663537e-05,
+	1.69315801940683741122e-03,  3.81380417594660496788e-14,
+	4.31152343750000000000e-01, -2.24485737471054726342e-04,
+	3.37974065132584655657e-03,  5.47506473696871965503e-14,
+	4.29199218750000000000e-01,  6.48251389284474038421e-05,
+	5.05979876948003948200e-03, -7.77736712491501755757e-14,
+	4.27734375000000000000e-01, -1.21346664490508163409e-04,
+	6.73338265892198251095e-03,  4.64201993862038338299e-14,
+	4.25781250000000000000e-01,  1.93414242269991870984e-04,
+	8.40054202649298531469e-03, -6.15851016981649463175e-14,
+	4.24316406250000000000e-01,  3.24004951620911408250e-05,
+	1.00613260078716848511e-02,  2.42094627571249276452e-14,
+	4.22851562500000000000e-01, -1.16249316606586018501e-04,
+	1.17157831778058607597e-02,  1.02446502632022136083e-13,
+	4.20898437500000000000e-01,  2.35605557698741955967e-04,
+	1.33639615580705140019e-02, -8.90120253501655099034e-14,
+	4.19433593750000000000e-01,  1.11264239556482558190e-04,
+	1.50059086249711981509e-02, -1.29094415458462591209e-14,
+	4.17968750000000000000e-01, -1.12831867493278681644e-06,
+	1.66416713191210874356e-02,  9.63383167445271714684e-14,
+	4.16503906250000000000e-01, -1.01706372724839400924e-04,
+	1.82712960527169343550e-02,  8.72595368429557388538e-15,
+	4.15039062500000000000e-01, -1.90602174505716872319e-04,
+	1.98948287170424009673e-02, -1.03138100631479649851e-13,
+	4.13085937500000000000e-01,  2.20335240641144540583e-04,
+	2.15123146906535112066e-02, -9.50928293020834325182e-14,
+	4.11621093750000000000e-01,  1.54415017527658799583e-04,
+	2.31237988471093558474e-02,  2.83943278212989380161e-14,
+	4.10156250000000000000e-01,  9.97919455072615493429e-05,
+	2.47293255624754237942e-02,  8.07440170292776395317e-14,
+	4.08691406250000000000e-01,  5.63414236487789688219e-05,
+	2.63289387223721860209e-02, -2.30383357336773701082e-14,
+	4.07226562500000000000e-01,  2.39406766757065139436e-05,
+	2.79226817287963058334e-02,  1.10169670453767353598e-13,
+	4.05761718750000000000e-01,  2.46872165134262276258e-06,
+	2.95105975085334648611e-02,  4.93720565196183278656e-15,
+	4.04296875000000000000e-01, -8.19366460920771434316e-06,
+	3.10927285183879575925e-02,  2.51310203162382112817e-14,
+	4.02832031250000000000e-01, -8.16397741859464182797e-06,
+	3.26691167533681436908e-02,  1.18962164429832383770e-18,
+	4.01367187500000000000e-01,  2.44198459374685435228e-06,
+	3.42398037525981635554e-02,  8.28512468930133405911e-16,
+	3.99902343750000000000e-01,  2.35100889657117949317e-05,
+	3.58048306061391485855e-02,  8.75653747626062756773e-14,
+	3.98437500000000000000e-01,  5.49278395428956229922e-05,
+	3.73642379618104314432e-02, -6.24388963060630303539e-14,
+	3.96972656250000000000e-01,  9.65843472588138492315e-05,
+	3.89180660304191405885e-02, -4.94811587092648279916e-14,
+	3.95507812500000000000e-01,  1.48370301539031609070e-04,
+	4.04663545932635315694e-02, -3.32004153847305504114e-14,
+	3.94042968750000000000e-01,  2.10177942313715884629e-04,
+	4.20091430075899552321e-02, -7.84200190311095675663e-14,
+	3.93066406250000000000e-01, -2.06380217376438585301e-04,
+	4.35464702125045732828e-02, -6.38994337449609020659e-14,
+	3.91601562500000000000e-01, -1.24846418195535645420e-04,
+	4.50783747351124475244e-02,  7.56672859527979118332e-14,
+	3.90136718750000000000e-01, -3.36051807632705977253e-05,
+	4.66048946966566290939e-02,  4.01281378865183585343e-15,
+	3.88671875000000000000e-01,  6.72416686449925799516e-05,
+	4.81260678172930056462e-02, -9.95621856735724291473e-14,
+	3.87207031250000000000e-01,  1.77593722935428160797e-04,
+	4.96419314222293905914e-02, -8.66270796660295774359e-14,
+	3.86230468750000000000e-01, -1.90929280442819873697e-04,
+	5.11525224474098649807e-02, -2.85760318883118213686e-14,
+	3.84765625000000000000e-01, -6.18624836246786191738e-05,
+	5.26578774447443720419e-02, -4.60766714673547402163e-14,
+	3.83300781250000000000e-01,  7.64165680429926838860e-05,
+	5.41580325871109380387e-02, -4.41241574137198451702e-15,
+	3.81835937500000000000e-01,  2.23812902860714350688e-04,
+	5.56530236740400141571e-02,  1.77132124068474926244e-14,
+	3.80859375000000000000e-01, -1.08048399888808636981e-04,
+	5.71428861364893236896e-02,  7.94061023512166970814e-14,
+	3.79394531250000000000e-01,  5.73027678582521487159e-05,
+	5.86276550423008302459e-02, -4.09357121019731422264e-14,
+	3.77929687500000000000e-01,  2.31494021198870326148e-04,
+	6.01073651002934639109e-02,  1.42683123582986854659e-14,
+	3.76953125000000000000e-01, -7.38457890424817653971e-05,
+	6.15820506664022104815e-02, -8.87771444585308139748e-14,
+	3.75488281250000000000e-01,  1.17757152812391488526e-04,
+	6.30517457470887165982e-02,  3.04141528595791861699e-16,
+	3.74511718750000000000e-01, -1.70347143156673798848e-04,
+	6.45164840052530053072e-02,  1.09785618204754728207e-13,
+	3.73046875000000000000e-01,  3.83175074915029491795e-05,
+	6.59762987643262022175e-02,  7.94695437017985820412e-14,
+	3.72070312500000000000e-01, -2.32896556078702739005e-04,
+	6.74312230125906353351e-02, -1.05489707017626250722e-14,
+	3.70605468750000000000e-01, -7.51085922510707105771e-06,
+	6.88812894077273085713e-02,  8.55670137780918903502e-14,
+	3.69140625000000000000e-01,  2.26110439310524524150e-04,
+	7.03265302820454962784e-02, -5.17008710491883908260e-14,
+	3.68164062500000000000e-01, -2.03957210845434487774e-05,
+	7.17669776452112273546e-02,  8.98430183072172708340e-14,
+	3.66699218750000000000e-01,  2.29452428985042500851e-04,
+	7.32026631903863744810e-02,  6.90753792825657476344e-14,
+	3.65722656250000000000e-01, -9.87278840566188543797e-07,
+	7.46336182969571382273e-02, -5.29575459209589227424e-14,
+	3.64746093750000000000e-01, -2.23512218090269243389e-04,
+	7.60598740348541468848e-02,  8.21300773441611226334e-14,
+	3.63281250000000000000e-01,  5.00812654655813041136e-05,
+	7.74814611697820510017e-02, -5.16143676219891914767e-14,
+	3.62304687500000000000e-01, -1.56845912923557408592e-04,
+	7.88984101652658864623e-02,  7.10365824037134675072e-14,
+	3.60839843750000000000e-01,  1.32193156598921695904e-04,
+	8.03107511885627900483e-02,  3.19101316741909685100e-14,
+	3.59863281250000000000e-01, -5.94386375971913281306e-05,
+	8.17185141129357361933e-02,  4.93445628662947786637e-14,
+	3.58886718750000000000e-01, -2.43533694411393933886e-04,
+	8.31217285224283841671e-02, -5.26621034927006855346e-15,
+	3.57421875000000000000e-01,  6.81165345095430138601e-05,
+	8.45204237150483095320e-02, -6.03656888821385379816e-14,
+	3.56445312500000000000e-01, -1.01122220408756796064e-04,
+	8.59146287066323566251e-02, -3.91261922117187469234e-14,
+	3.54980468750000000000e-01,  2.25241688442389379919e-04,
+	8.73043722347119910410e-02, -1.13067942752057776092e-13,
+	3.54003906250000000000e-01,  7.05758112498976972757e-05,
+	8.86896827614691574126e-02, -1.03787147339334167853e-13,
+	3.53027343750000000000e-01, -7.69076635477210153761e-05,
+	9.00705884778290055692e-02, -7.80571905975766493602e-14,
+	3.52050781250000000000e-01, -2.17276923314975065841e-04,
+	9.14471173066431219922e-02, -8.88652798498477943102e-14,
+	3.50585937500000000000e-01,  1.37681954992012239771e-04,
+	9.28192969058727612719e-02,  2.91715714238804649429e-14,
+	3.49609375000000000000e-01,  1.13399912970688001858e-05,
+	9.41871546726815722650e-02, -9.84558331437688430296e-14,
+	3.48632812500000000000e-01, -1.08087210870006647317e-04,
+	9.55507177452545874985e-02,  7.69788746420838088291e-14,
+	3.47656250000000000000e-01, -2.20664477398537883616e-04,
+	9.69100130080278177047e-02,  2.85966540684811372764e-14,
+	3.46191406250000000000e-01,  1.61825423621395249199e-04,
+	9.82650670930524938740e-02, -2.99774543256366758639e-14,
+	3.45214843750000000000e-01,  6.27567693554903060366e-05,
+	9.96159063840877934126e-02, -1.06450328797231294782e-13,
+	3.44238281250000000000e-01, -2.96516300852387664855e-05,
+	1.00962557019329324248e-01, -7.59958816546362928505e-14,
+	3.43261718750000000000e-01, -1.15461443726950986795e-04,
+	1.02305044894819729961e-01, -5.71520637766236427372e-14,
+	3.42285156250000000000e-01, -1.94733581592406525306e-04,
+	1.03643395666949800216e-01,  7.50168534546849711063e-14,
+	3.40820312500000000000e-01,  2.20753043657876920399e-04,
+	1.04977634756096449564e-01, -7.00842029189768334535e-15,
+	3.39843750000000000000e-01,  1.54376505298066911669e-04,
+	1.06307787348441706854e-01, -5.19606828867813926356e-15,
+	3.38867187500000000000e-01,  9.43593513184996237567e-05,
+	1.07633878399838067708e-01, -8.54926688828361532338e-15,
+	3.37890625000000000000e-01,  4.06435934117564706030e-05,
+	1.08955932638082231279e-01,  4.25021379932469108471e-14,
+	3.36914062500000000000e-01, -6.82805384100642861930e-06,
+	1.10273974566098331707e-01, -6.04153712816843726270e-14,
+	3.35937500000000000000e-01, -4.81121835877103376880e-05,
+	1.11588028463756927522e-01,  1.12249376330107012154e-13,
+	3.34960937500000000000e-01, -8.32647071311208510254e-05,
+	1.12898118392195101478e-01, -8.36892781009222148022e-15,
+	3.33984375000000000000e-01, -1.12340864166763130345e-04,
+	1.14204268194498581579e-01, -2.82718903597160285208e-14,
+	3.33007812500000000000e-01, -1.35395232836922526634e-04,
+	1.15506501499794467236e-01, -7.95537480117159915394e-14,
+	3.32031250000000000000e-01, -1.52481739604573487013e-04,
+	1.16804841725070218672e-01, -7.45414465629985125745e-14,
+	3.31054687500000000000e-01, -1.63653668950988447680e-04,
+	1.18099312077902141027e-01,  9.23461251360446444230e-14,
+	3.30078125000000000000e-01, -1.68963672900688784487e-04,
+	1.19389935559411242139e-01,  7.78223415092434315688e-14,
+	3.29101562500000000000e-01, -1.68463780377313973938e-04,
+	1.20676734965854848269e-01, -4.96763525351256661673e-14,
+	3.28125000000000000000e-01, -1.62205406393900068490e-04,
+	1.21959732891127714538e-01,  1.04883842328348867928e-13,
+	3.27148437500000000000e-01, -1.50239361080976814100e-04,
+	1.23238951730400003726e-01,  5.55831833480376480169e-15,
+	3.26171875000000000000e-01, -1.32615858555812669633e-04,
+	1.24514413680572033627e-01,  7.61250800341857247927e-14,
+	3.25195312500000000000e-01, -1.09384525636058830308e-04,
+	1.25786140744367003208e-01, -8.15335778092707441110e-14,
+	3.24218750000000000000e-01, -8.05944104009682899372e-05,
+	1.27054154731013113633e-01, -9.21832060605769019103e-14,
+	3.23242187500000000000e-01, -4.62939906032910515328e-05,
+	1.28318477259654173395e-01,  2.63769417285575744420e-14,
+	3.22265625000000000000e-01, -6.53118193487571363178e-06,
+	1.29579129761395961395e-01,  2.85978436901254361813e-14,
+	3.21289062500000000000e-01,  3.86466538510632336080e-05,
+	1.30836133480897842674e-01,  2.92053907731768478975e-14,
+	3.20312500000000000000e-01,  8.91927009581206854151e-05,
+	1.32089509479101252509e-01, -7.70956838348938250180e-14,
+	3.19335937500000000000e-01,  1.45060681702493903238e-04,
+	1.33339278634821312153e-01, -8.99588073392945621148e-14,
+	3.18359375000000000000e-01,  2.06204848803632882510e-04,
+	1.34585461647247939254e-01,  8.23955761035742017397e-14,
+	3.17871093750000000000e-01, -2.15701272192948926036e-04,
+	1.35828079038446958293e-01, -2.08845046407836938706e-14,
+	3.16894531250000000000e-01, -1.44139890363339368256e-04,
+	1.37067151154042221606e-01, -6.77022241000305619811e-14,
+	3.15917968750000000000e-01, -6.74364567259435330245e-05,
+	1.38302698166171467165e-01,  1.09987944451936933778e-13,
+	3.14941406250000000000e-01,  1.43653285622319502082e-05,
+	1.39534740075987429009e-01, -1.44252216610046745482e-14,
+	3.13964843750000000000e-01,  1.01222259131265193244e-04,
+	1.40763296713885210920e-01,  5.30501393867786710616e-14,
+	3.12988281250000000000e-01,  1.93091615443571483664e-04,
+	1.41988387743140265229e-01,  1.04263940021279049110e-13,
+	3.12500000000000000000e-01, -1.98350092043629550693e-04,
+	1.43210032661045261193e-01, -1.96477519568340466451e-14,
+	3.11523437500000000000e-01, -9.65821296009303068876e-05,
+	1.44428250800274327048e-01,  6.93077894023672743149e-14,
+	3.10546875000000000000e-01,  1.00729531633180977024e-05,
+	1.45643061332066281466e-01, -4.14783916030888665295e-14,
+	3.09570312500000000000e-01,  1.21574316803531689408e-04,
+	1.46854483266452007229e-01,  1.75788781096449661839e-14,
+	3.08593750000000000000e-01,  2.37881575645744106464e-04,
+	1.48062535455437682685e-01,  2.06221801693148539707e-17,
+	3.08105468750000000000e-01, -1.29326458497318889018e-04,
+	1.49267236593914276455e-01, -1.05915091841917845485e-13,
+	3.07128906250000000000e-01, -3.52678250699481025010e-06,
+	1.50468605221249163151e-01,  6.69806427840598284618e-14,
+	3.06152343750000000000e-01,  1.26960291962721432378e-04,
+	1.51666659724241981166e-01,  2.09759191017714301855e-14,
+	3.05664062500000000000e-01, -2.26185117493220126401e-04,
+	1.52861418337124632671e-01,  8.17959648126377251791e-14,
+	3.04687500000000000000e-01, -8.64387199110469014529e-05,
+	1.54052899144517141394e-01,  1.08002756419697834358e-13,
+	3.03710937500000000000e-01,  5.78804432581089570663e-05,
+	1.55241120082564520999e-01, -3.41631425376146048646e-15,
+	3.02734375000000000000e-01,  2.06734992459040544093e-04,
+	1.56426098940301017137e-01, -6.12408596264085476395e-14,
+	3.02246093750000000000e-01, -1.28193295563945982218e-04,
+	1.57607853361696470529e-01, -2.83725160194853232033e-14,
+	3.01269531250000000000e-01,  2.96215067275552271404e-05,
+	1.58786400847247932688e-01, -3.71252987765954398474e-14,
+	3.00292968750000000000e-01,  1.91861972249913185400e-04,
+	1.59961758755116534303e-01,  2.89007955970769269688e-14,
+	2.99804687500000000000e-01, -1.29788936031083871519e-04,
+	1.61133944303173848311e-01,  2.24663238805876322284e-14,
+	2.98828125000000000000e-01,  4.11958796571717172441e-05,
+	1.62302974570138758281e-01, -9.08126019471926461513e-14,
+	2.97851562500000000000e-01,  2.16500146735838815745e-04,
+	1.63468866496941700461e-01, -1.03656664334798151429e-13,
+	2.97363281250000000000e-01, -9.21920328008880239070e-05,
+	1.64631636888543653185e-01,  8.69496087182595636699e-14,
+	2.96386718750000000000e-01,  9.16475626199143465420e-05,
+	1.65791302415982499951e-01, -1.13210007596659031852e-13,
+	2.95898437500000000000e-01, -2.08577480764713079752e-04,
+	1.66947879615918282070e-01, -1.06793724672239183364e-13,
+	2.94921875000000000000e-01, -1.63382168900056283013e-05,
+	1.68101384894043803797e-01, -1.00508967662701493981e-13,
+	2.93945312500000000000e-01,  1.80050905376899142559e-04,
+	1.69251834525312006008e-01,  6.37700932477328230545e-14,
+	2.93457031250000000000e-01, -1.07724212447314298519e-04,
+	1.70399244656209702953e-01,  1.30772687859733169154e-14,
+	2.92480468750000000000e-01,  9.68664269275470432357e-05,
+	1.71543631304984955932e-01, -2.43608918524777854660e-14,
+	2.91992187500000000000e-01, -1.82771837972525247546e-04,
+	1.72685010363693436375e-01,  7.63034572163432255129e-14,
+	2.91015625000000000000e-01,  2.98916681478216721482e-05,
+	1.73823397599790041568e-01,  6.91295711136094877871e-14,
+	2.90527343750000000000e-01, -2.41737047043164807484e-04,
+	1.74958808656811015680e-01, -3.78370112973479360615e-14,
+	2.89550781250000000000e-01, -2.11266478321148984962e-05,
+	1.76091259055738191819e-01, -5.69497375294414371659e-14,
+	2.88574218750000000000e-01,  2.03410775279137335039e-04,
+	1.77220764196590607753e-01,  6.05067857426721057865e-14,
+	2.88085937500000000000e-01, -5.64365486205495360821e-05,
+	1.78347339360016121645e-01, -1.10727544391659341158e-13,
+	2.87109375000000000000e-01,  1.75863675019296840070e-04,
+	1.79470999707064038375e-01, -2.19909015975424692656e-15,
+	2.86621093750000000000e-01, -7.62809478544642234317e-05,
+	1.80591760282368340995e-01, -1.06604932342821294838e-14,
+	2.85644531250000000000e-01,  1.63662496098889147927e-04,
+	1.81709636013920317055e-01, -6.21425196904294747492e-14,
+	2.85156250000000000000e-01, -8.08977763270054422724e-05,
+	1.82824641714660174330e-01, -1.05295381432376080692e-14,
+	2.84179687500000000000e-01,  1.66571751233933202773e-04,
+	1.83936792084068656550e-01, -5.14108517531626933115e-14,
+	2.83691406250000000000e-01, -7.05201091008472486128e-05,
+	1.85046101708621790749e-01, -1.41053932828309382200e-14,
+	2.82714843750000000000e-01,  1.84360746774727427217e-04,
+	1.86152585063609876670e-01, -3.27402747723165126762e-14,
+	2.82226562500000000000e-01, -4.53762887500815239933e-05,
+	1.87256256513819607790e-01, -9.50469140561530343541e-14,
+	2.81250000000000000000e-01,  2.16803461348019958169e-04,
+	1.88357130314670939697e-01, -6.02686257813666570338e-14,
+	2.80761718750000000000e-01, -5.69004486750535675923e-06,
+	1.89455220613581332145e-01,  8.14119125636251124094e-14,
+	2.80273437500000000000e-01, -2.24602821832574611055e-04,
+	1.90550541451329991105e-01, -6.44869380755127767215e-14,
+	2.79296875000000000000e-01,  4.83193900313263306214e-05,
+	1.91643106761830495088e-01,  7.78851548831767820845e-15,
+	2.78808593750000000000e-01, -1.63512629116621850678e-04,
+	1.92732930374859279254e-01,  3.93885792150857279916e-14,
+	2.77832031250000000000e-01,  1.16437168081169693107e-04,
+	1.93820026016055635409e-01,  5.71933081369622745528e-14,
+	2.77343750000000000000e-01, -8.84199071509529155918e-05,
+	1.94904407308285954059e-01,  4.67907756283491754611e-14,
+	2.76367187500000000000e-01,  1.98452716996188742752e-04,
+	1.95986087772553219111e-01,  6.72858372823109724619e-14,
+	2.75878906250000000000e-01,  4.66869683543123308634e-07,
+	1.97065080829361249926e-01, -1.01362762270599578017e-13,
+	2.75390625000000000000e-01, -1.94121615761218117586e-04,
+	1.98141399798714701319e-01,  4.07016736414361192153e-14,
+	2.74414062500000000000e-01,  1.02943345018439213275e-04,
+	1.99215057902847547666e-01, -2.85554097081425054607e-14,
+	2.73925781250000000000e-01, -8.49256656835766524311e-05,
+	2.00286068265313588199e-01,  3.09633496850619099877e-14,
+	2.72949218750000000000e-01,  2.18809179318102885962e-04,
+	2.01354443913260183763e-01,  1.10292085980532723470e-13,
+	2.72460937500000000000e-01,  3.75609490991859746971e-05,
+	2.02420197778110377840e-01, -7.99880732631188198959e-14,
+	2.71972656250000000000e-01, -1.40413298331374373660e-04,
+	2.03483342695562896552e-01, -7.06546519727758824611e-14,
+	2.70996093750000000000e-01,  1.73143731054799709847e-04,
+	2.04543891407865885412e-01,  2.00473871801975219530e-14,
+	2.70507812500000000000e-01,  1.64581443422841538681e-06,
+	2.05601856564271656680e-01, -5.20125318774796106903e-14,
+	2.70019531250000000000e-01, -1.66649290697893487628e-04,
+	2.06657250721264063031e-01,  2.09708572251651565555e-14,
+	2.69042968750000000000e-01,  1.56516400683941582592e-04,
+	2.07710086344604860642e-01, -5.34013790320969163146e-14,
+	2.68554687500000000000e-01, -5.44265161239642816766e-06,
+	2.08760375809106335510e-01, -5.69485479077971508828e-14,
+	2.68066406250000000000e-01, -1.64268015704896686241e-04,
+	2.09808131400222919183e-01,  2.02277262583889142185e-14,
+	2.67089843750000000000e-01,  1.68298959693432409728e-04,
+	2.10853365314960683463e-01, -6.74998978528483690316e-14,
+	2.66601562500000000000e-01,  1.56733926438078621584e-05,
+	2.11896089661877340404e-01,  3.06156372331648258896e-14,
+	2.66113281250000000000e-01, -1.33885634611320859929e-04,
+	2.12936316463128605392e-01,  5.70303985309780110357e-14,
+	2.65136718750000000000e-01,  2.07881171795866063817e-04,
+	2.13974057654468197143e-01, -2.24490018768797346346e-14,
+	2.64648437500000000000e-01,  6.43895648392092283035e-05,
+	2.15009325086157332407e-01, -1.06430896238706277779e-13,
+	2.64160156250000000000e-01, -7.61007458848743926398e-05,
+	2.16042130523874220671e-01, -5.54749369764412909486e-14,
+	2.63671875000000000000e-01, -2.13611096605526365466e-04,
+	2.17072485649850932532e-01, -2.66339466042440166928e-14,
+	2.62695312500000000000e-01,  1.40118628209143914051e-04,
+	2.18100402063100773375e-01,  9.20039188826810547465e-14,
+	2.62207031250000000000e-01,  8.50499347280160056283e-06,
+	2.19125891280782525428e-01,  1.00544136658333600652e-13,
+	2.61718750000000000000e-01, -1.20191488864781462122e-04,
+	2.20148964738427821430e-01,  3.41549724032849044447e-14,
+	2.60742187500000000000e-01,  2.42289887869642903053e-04,
+	2.21169633790850639343e-01,  1.87175484233564683564e-14,
+	2.60253906250000000000e-01,  1.19366272792664822279e-04,
+	2.22187909713284170721e-01, -1.09867832672637045496e-13,
+	2.59765625000000000000e-01, -7.01244783953554418356e-07,
+	2.23203803701380820712e-01, -5.83511599667663042830e-14,
+	2.59277343750000000000e-01, -1.17932637570004951216e-04,
+	2.24217326872803823790e-01,  7.08617522402181931655e-14,
+	2.58789062500000000000e-01, -2.32347692482632830384e-04,
+	2.25228490267681991099e-01,  5.49735957970387117185e-14,
+	2.57812500000000000000e-01,  1.44315237198301341134e-04,
+	2.26237304848837084137e-01,  4.49549034658824074139e-14,
+	2.57324218750000000000e-01,  3.54742297047867531277e-05,
+	2.27243781503148056800e-01, -8.55257694177532711563e-14,
+	2.56835937500000000000e-01, -7.06087073153166810144e-05,
+	2.28247931041551055387e-01, -3.51743985071913286522e-14,
+	2.56347656250000000000e-01, -1.73952638865281373603e-04,
+	2.29249764200631034328e-01,  3.01095550771638259513e-14,
+	2.55371093750000000000e-01,  2.13704795361995122591e-04,
+	2.30249291642849129857e-01, -6.13621532708134248384e-14,
+	2.54882812500000000000e-01,  1.15782378973550183752e-04,
+	2.31246523956770033692e-01, -3.35697739298077613718e-14,
+	2.54394531250000000000e-01,  2.05428168935191721558e-05,
+	2.32241471658653608756e-01, -8.13300619404442522566e-14,
+	2.53906250000000000000e-01, -7.20322665925390913204e-05,
+	2.33234145192227515508e-01,  2.24563648217752536045e-14,
+	2.53417968750000000000e-01, -1.61961079766587964313e-04,
+	2.34224554930278827669e-01, -7.01874526898045720801e-15,
+	2.52441406250000000000e-01,  2.39019584619245168159e-04,
+	2.35212711174426658545e-01, -8.87890769228139884243e-14,
+	2.51953125000000000000e-01,  1.54329347465913550765e-04,
+	2.36198624156031655730e-01, -4.26814251711427580109e-14,
+	2.51464843750000000000e-01,  7.22317414761716741637e-05,
+	2.37182304037332869484e-01, -9.05382335865257391398e-14,
+	2.50976562500000000000e-01, -7.29079067163007082947e-06,
+	2.38163760911220379057e-01, -3.80537146992036427226e-16,
+	2.50488281250000000000e-01, -8.42556481250723409825e-05,
+	2.39143004802826908417e-01, -5.66455960008456537845e-14,
+	2.49755859375000000000e-01,  8.54605513650963594455e-05,
+	2.40120045669073078898e-01,  8.94890211164708905357e-15,
+	2.49267578125000000000e-01,  1.35594696916320151203e-05,
+	2.41094893400259024929e-01,  3.32820497487060501571e-14,
+	2.48779296875000000000e-01, -5.58352033389980338804e-05,
+	2.42067557820064394036e-01,  2.25198061723571417199e-14,
+	2.48046875000000000000e-01,  1.21400373286758664240e-04,
+	2.43038048686230467865e-01,  6.39724194949150286257e-14,
+	2.47558593750000000000e-01,  5.69683151057191061598e-05,
+	2.44006375691469656886e-01,  3.95632351361580442778e-15,
+	2.47070312500000000000e-01, -5.00723948340471432082e-06,
+	2.44972548463465500390e-01,  2.86172762486504531843e-14,
+	2.46582031250000000000e-01, -6.45426308592729898158e-05,
+	2.45936576566009534872e-01,  1.01438677563653321610e-13,
+	2.46093750000000000000e-01, -1.21654054795425044591e-04,
+	2.46898469499456041376e-01,  7.65101366872192395093e-14,
+	2.45361328125000000000e-01,  6.77830609436377075913e-05,
+	2.47858236700949419173e-01,  3.28932807777758210463e-14,
+	2.44873046875000000000e-01,  1.54715550274622883921e-05,
+	2.48815887545333680464e-01, -7.93268570781046440450e-14,
+	2.44384765625000000000e-01, -3.44637189945760875681e-05,
+	2.49771431345152450376e-01,  1.10392618881118862456e-13,
+	2.43896484375000000000e-01, -8.20383942270441193431e-05,
+	2.50724877352695330046e-01, -1.09907283450400359908e-13,
+	2.43164062500000000000e-01,  1.16872658057916577494e-04,
+	2.51676234757951533538e-01,  4.91271053456192724949e-14,
+	2.42675781250000000000e-01,  7.39728269267857566332e-05,
+	2.52625512692020492977e-01, -8.65345705106494875351e-16,
+	2.42187500000000000000e-01,  3.33875103103875383345e-05,
+	2.53572720225520242820e-01, -1.08564105151430641264e-13,
+	2.41699218750000000000e-01, -4.89838645115678543559e-06,
+	2.54517866369724288234e-01,  2.24138048995812889786e-16,
+	2.41210937500000000000e-01, -4.08998270445382237849e-05,
+	2.55460960077698473469e-01,  1.00109895416448408170e-13,
+	2.40722656250000000000e-01, -7.46316456007188784322e-05,
+	2.56402010244300981867e-01, -2.50396058552504749668e-14,
+	2.40234375000000000000e-01, -1.06108548094021863553e-04,
+	2.57341025706182335853e-01, -7.87618883633869438141e-14,
+	2.39501953125000000000e-01,  1.08795511276870427429e-04,
+	2.58278015242922265315e-01,  1.09041162462807868945e-13,
+	2.39013671875000000000e-01,  8.17848287257373683743e-05,
+	2.59212987578166575986e-01, -6.22159478787115088748e-14,
+	2.38525390625000000000e-01,  5.69856995331928707247e-05,
+	2.60145951378262907383e-01, -1.12301690065570708908e-13,
+	2.38037109375000000000e-01,  3.43839167183466383492e-05,
+	2.61076915254307095893e-01, -4.44945145874430474500e-14,
+	2.37548828125000000000e-01,  1.39653947274954670318e-05,
+	2.62005887762370548444e-01, -9.60759297411601904002e-14,
+	2.37060546875000000000e-01, -4.28383186040964072011e-06,
+	2.62932877403272868833e-01, -3.91656811365646149144e-14,
+	2.36572265625000000000e-01, -2.03776096117704719332e-05,
+	2.63857892623946099775e-01, -7.81970706037580460872e-14,
+	2.36083984375000000000e-01, -3.43296675000681950399e-05,
+	2.64780941816979975556e-01,  6.66367905744564544596e-14,
+	2.35595703125000000000e-01, -4.61536181515511016791e-05,
+	2.65702033322213537758e-01,  2.46764337456490489534e-14,
+	2.35107421875000000000e-01, -5.58629590751207616710e-05,
+	2.66621175426053014235e-01, -9.10087892627375512587e-14,
+	2.34619140625000000000e-01, -6.34710738766500393764e-05,
+	2.67538376362153940136e-01,  8.15586580639428280026e-14,
+	2.34130859375000000000e-01, -6.89912334579623572799e-05,
+	2.68453644313012773637e-01,  4.23576221600335023275e-15,
+	2.33642578125000000000e-01, -7.24365972006977301657e-05,
+	2.69366987408602653886e-01,  4.09340837612376585175e-14,
+	2.33154296875000000000e-01, -7.38202141352874721897e-05,
+	2.70278413728192390408e-01,  7.19681047700217792833e-14,
+	2.32666015625000000000e-01, -7.31550240952554811560e-05,
+	2.71187931300346463104e-01, -7.71445982897632190634e-14,
+	2.32177734375000000000e-01, -7.04538588570607991323e-05,
+	2.72095548102697648574e-01,  1.60098133859981779465e-14,
+	2.31689453125000000000e-01, -6.57294432656919133760e-05,
+	2.73001272063766009524e-01, -2.83530834609603062004e-14,
+	2.31201171875000000000e-01, -5.89943963462206255729e-05,
+	2.73905111062049400061e-01, -6.71957563242525793393e-14,
+	2.30712890625000000000e-01, -5.02612324015189263762e-05,
+	2.74807072926932960399e-01,  6.70571812851835069137e-14,
+	2.30224609375000000000e-01, -3.95423620963397982344e-05,
+	2.75707165439598611556e-01,  6.39736091165593275306e-14,
+	2.29736328125000000000e-01, -2.68500935279589291046e-05,
+	2.76605396332570308005e-01, -7.39778653935819192270e-15,
+	2.29248046875000000000e-01, -1.21966332835713838276e-05,
+	2.77501773290396158700e-01,  1.79361608341990077926e-14,
+	2.28759765625000000000e-01,  4.40591251536600569770e-06,
+	2.78396303950330548105e-01,  1.13271874137166966954e-13,
+	2.28271484375000000000e-01,  2.29455371816588874845e-05,
+	2.79288995902788883541e-01, -4.11278748544554861861e-15,
+	2.27783203125000000000e-01,  4.34103324435817161057e-05,
+	2.80179856690892847837e-01, -3.17900198948910802281e-14,
+	2.27294921875000000000e-01,  6.57884874385846135994e-05,
+	2.81068893811834641383e-01, -6.39581578213391260333e-14,
+	2.26806640625000000000e-01,  9.00682877193221956887e-05,
+	2.81956114716649608454e-01,  1.44912607856501974787e-14,
+	2.26318359375000000000e-01,  1.16238114271828674282e-04,
+	2.82841526811125731911e-01, -6.82086679908078586699e-15,
+	2.26074218750000000000e-01, -9.98541824543335796447e-05,
+	2.83725137455576259526e-01, -6.54990044177250619556e-14,
+	2.25585937500000000000e-01, -6.99387835041219538441e-05,
+	2.84606953965294451336e-01,  8.60028267291304988367e-14,
+	2.25097656250000000000e-01, -3.81676523634253466659e-05,
+	2.85486983611690448015e-01,  1.06916231669424767705e-13,
+	2.24609375000000000000e-01, -4.55203589400428574620e-06,
+	2.86365233621609149850e-01,  1.10008566632106249686e-13,
+	2.24121093750000000000e-01,  3.08969097428787845450e-05,
+	2.87241711178239711444e-01,  1.08187367854909784908e-13,
+	2.23632812500000000000e-01,  6.81681181739796369966e-05,
+	2.88116423421570289065e-01, -8.77339699955191190199e-14,
+	2.23144531250000000000e-01,  1.07250611912586103834e-04,
+	2.88989377447933293297e-01, -6.53186653395336602239e-14,
+	2.22900390625000000000e-01, -9.60071235321285004283e-05,
+	2.89860580311597004766e-01, -5.66523096507912931805e-14,
+	2.22412109375000000000e-01, -5.33346405350642400935e-05,
+	2.90730039024083453114e-01,  8.57899622054434118293e-14,
+	2.21923828125000000000e-01, -8.88328022461501323834e-06,
+	2.91597760555305285379e-01,  9.08701899020746307735e-14,
+	2.21435546875000000000e-01,  3.73363266583025493837e-05,
+	2.92463751833111018641e-01,  5.87542034565338077462e-14,
+	2.20947265625000000000e-01,  8.53136339114669530652e-05,
+	2.93328019743967161048e-01,  1.10674340109225742169e-13,
+	2.20703125000000000000e-01, -1.09102445967325636304e-04,
+	2.94190571133640332846e-01,  3.53963876066032072571e-14,
+	2.20214843750000000000e-01, -5.76410426089745008449e-05,
+	2.95051412806742519024e-01,  6.92983277099172564917e-14,
+	2.19726562500000000000e-01, -4.45307859196071380135e-06,
+	2.95910551527867937693e-01,  8.16154284324516042638e-14,
+	2.19238281250000000000e-01,  5.04512297484573552257e-05,
+	2.96767994021593040088e-01, -1.06626090064567109644e-13,
+	2.18750000000000000000e-01,  1.07061746520606057564e-04,
+	2.97623746972021763213e-01,  4.79297515752136034047e-14,
+	2.18505859375000000000e-01, -7.87722095138155685868e-05,
+	2.98477817024831892923e-01,  7.72919356449162598805e-14,
+	2.18017578125000000000e-01, -1.87793657206512195647e-05,
+	2.99330210786138195544e-01, -5.13914191946376763086e-14,
+	2.17529296875000000000e-01,  4.28897536349664941220e-05,
+	3.00180934822947165230e-01, -8.39951535971003337717e-14,
+};
+
+static const double C[] = {
+	3.01029995664066518657e-01,
+	-8.53234431705710655851e-14,
+	-1.15129254649702295055e+00,
+	1.76729937015472060580e+00,
+	-3.05201788842396570800e+00,
+	5.62204603948530756696e+00,
+	-1.07877120310586054330e+01,
+	4503599627370496.0,
+	0.0
+};
+
+#define	lg2hi	C[0]
+#define	lg2lo	C[1]
+#define	P2	C[2]
+#define	P3	C[3]
+#define	P4	C[4]
+#define	P5	C[5]
+#define	P6	C[6]
+#define	two52	C[7]
+#define	zero	C[8]
+
+#define	PROCESS(N)							\
+	i##N = (i##N + 0x800) & ~0xfff;					\
+	e = (i##N & 0x7ff00000) - 0x3ff00000;				\
+	z##N##.i[HIWORD] -= e;						\
+	w##N##.i[HIWORD] = i##N - e;					\
+	w##N##.i[LOWORD] = 0;						\
+	n##N += (e >> 20);						\
+	i##N = (i##N >> 10) & 0x3fc;					\
+	d##N = z##N##.d - w##N##.d;					\
+	h##N = d##N * TBL[i##N];					\
+	l##N = d##N * TBL[i##N+1];					\
+	s##N = h##N + l##N;						\
+	b##N = (s##N * s##N) * (P2 + s##N * (P3 + s##N * (P4 +		\
+	    s##N * (P5 + s##N * P6))));					\
+	*y = (n##N * lg2hi + TBL[i##N+2]) + (h##N + (l##N +		\
+	    (n##N * lg2lo + TBL[i##N+3]) + b##N));			\
+	y += stridey
+
+#define	PREPROCESS(N, index, label)					\
+	i##N = HI(*x);							\
+	z##N##.d = *x;							\
+	x += stridex;							\
+	n##N = 0;							\
+	if ((i##N & 0x7ff00000) == 0x7ff00000) { /* inf or NaN */	\
+		y[index] = z##N##.d * ((i##N < 0)? zero : z##N##.d);	\
+		goto label;						\
+	} else if (i##N < 0x00100000) { /* subnormal, negative, zero */	\
+		if (((i##N << 1) | z##N##.i[LOWORD]) == 0) {		\
+			y[index] = P2 / zero;				\
+			goto label;					\
+		} else if (i##N < 0) {					\
+			y[index] = zero / zero;				\
+			goto label;					\
+		}							\
+		z##N##.d *= two52;					\
+		n##N = -52;						\
+		i##N = z##N##.i[HIWORD];				\
+	}
+
+void
+__vlog10(int n, double *restrict x, int stridex, double *restrict y,
+	int stridey)
+{
+	union {
+		unsigned	i[2];
+		double		d;
+	} z0, z1, z2, z3, w0, w1, w2, w3;
+	double	b0, b1, b2, b3;
+	double	d0, d1, d2, d3;
+	double	h0, h1, h2, h3;
+	double	l0, l1, l2, l3;
+	double	s0, s1, s2, s3;
+	int	i0, i1, i2, i3, e;
+	int	n0, n1, n2, n3;
+
+	w0.i[LOWORD] = 0;
+	w1.i[LOWORD] = 0;
+	w2.i[LOWORD] = 0;
+	w3.i[LOWORD] = 0;
+
+	y -= stridey;
+
+	for (;;) {
+begin:
+		y += stridey;
+
+		if (--n < 0)
+			break;
+
+		PREPROCESS(0, 0, begin);
+
+		if (--n < 0)
+			goto process1;
+
+		PREPROCESS(1, stridey, process1);
+
+		if (--n < 0)
+			goto process2;
+
+		PREPROCESS(2, (stridey << 1), process2);
+
+		if (--n < 0)
+			goto process3;
+
+		PREPROCESS(3, (stridey << 1) + stridey, process3);
+
+		i0 = (i0 + 0x800) & ~0xfff;
+		e = (i0 & 0x7ff00000) - 0x3ff00000;
+		z0.i[HIWORD] -= e;
+		w0.i[HIWORD] = i0 - e;
+		n0 += (e >> 20);
+		i0 = (i0 >> 10) & 0x3fc;
+
+		i1 = (i1 + 0x800) & ~0xfff;
+		e = (i1 & 0x7ff00000) - 0x3ff00000;
+		z1.i[HIWORD] -= e;
+		w1.i[HIWORD] = i1 - e;
+		n1 += (e >> 20);
+		i1 = (i1 >> 10) & 0x3fc;
+
+		i2 = (i2 + 0x800) & ~0xfff;
+		e = (i2 & 0x7ff00000) - 0x3ff00000;
+		z2.i[HIWORD] -= e;
+		w2.i[HIWORD] = i2 - e;
+		n2 += (e >> 20);
+		i2 = (i2 >> 10) & 0x3fc;
+
+		i3 = (i3 + 0x800) & ~0xfff;
+		e = (i3 & 0x7ff00000) - 0x3ff00000;
+		z3.i[HIWORD] -= e;
+		w3.i[HIWORD] = i3 - e;
+		n3 += (e >> 20);
+		i3 = (i3 >> 10) & 0x3fc;
+
+		d0 = z0.d - w0.d;
+		d1 = z1.d - w1.d;
+		d2 = z2.d - w2.d;
+		d3 = z3.d - w3.d;
+
+		h0 = d0 * TBL[i0];
+		h1 = d1 * TBL[i1];
+		h2 = d2 * TBL[i2];
+		h3 = d3 * TBL[i3];
+
+		l0 = d0 * TBL[i0+1];
+		l1 = d1 * TBL[i1+1];
+		l2 = d2 * TBL[i2+1];
+		l3 = d3 * TBL[i3+1];
+
+		s0 = h0 + l0;
+		s1 = h1 + l1;
+		s2 = h2 + l2;
+		s3 = h3 + l3;
+
+		b0 = (s0 * s0) * (P2 + s0 * (P3 + s0 * (P4 +
+		    s0 * (P5 + s0 * P6))));
+		b1 = (s1 * s1) * (P2 + s1 * (P3 + s1 * (P4 +
+		    s1 * (P5 + s1 * P6))));
+		b2 = (s2 * s2) * (P2 + s2 * (P3 + s2 * (P4 +
+		    s2 * (P5 + s2 * P6))));
+		b3 = (s3 * s3) * (P2 + s3 * (P3 + s3 * (P4 +
+		    s3 * (P5 + s3 * P6))));
+
+		*y = (n0 * lg2hi + TBL[i0+2]) + (h0 + (l0 +
+		    (n0 * lg2lo + TBL[i0+3]) + b0));
+		y += stridey;
+		*y = (n1 * lg2hi + TBL[i1+2]) + (h1 + (l1 +
+		    (n1 * lg2lo + TBL[i1+3]) + b1));
+		y += stridey;
+		*y = (n2 * lg2hi + TBL[i2+2]) + (h2 + (l2 +
+		    (n2 * lg2lo + TBL[i2+3]) + b2));
+		y += stridey;
+		*y = (n3 * lg2hi + TBL[i3+2]) + (h3 + (l3 +
+		    (n3 * lg2lo + TBL[i3+3]) + b3));
+		continue;
+
+process1:
+		PROCESS(0);
+		continue;
+
+process2:
+		PROCESS(0);
+		PROCESS(1);
+		continue;
+
+process3:
+		PROCESS(0);
+		PROCESS(1);
+		PROCESS(2);
+	}
+}
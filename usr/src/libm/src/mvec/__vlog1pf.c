@@ -0,0 +1,286 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#ifdef __RESTRICT
+#define restrict _Restrict
+#else
+#define restrict
+#endif
+
+/* float log1pf(float x)
+ *
+ * Method :
+ *	1. Special cases:
+ *		for x < -1, -Inf	=> QNaN + invalid;
+ *		for x = -1		=> -Inf + divide-by-zero;
+ *		for x = +Inf		=> Inf;
+ *		for x = NaN		=> QNaN;
+ *		for |x| < 2**-29	=> x (inexact).
+ *	2. Computes u = 1 + x in double precision.  This is exact
+ *	for all float x with |x| >= 2**-29 and x < 2**29, and for
+ *	larger x the relative error of u is too small to matter.
+ *	Then log1p(x) = log(u) is computed as in logf:
+ *		u = m * 2**n => log(u) = n * log(2) + log(m),
+ *		m = [1, 2).
+ *	Let m = m0 + dm, where m0 = 1 + k / 32,
+ *		k = [0, 32],
+ *		dm = [-1/64, 1/64].
+ *	Then log(m) = log(m0 + dm) = log(m0) + log(1+y),
+ *		where y = dm*(1/m0), y = [-1/66, 1/64].
+ *	dm is formed exactly in double precision as the difference
+ *	of m and m0, both scaled by 2**23, so the logf table can be
+ *	used unchanged.
+ * Accuracy:
+ *	The maximum relative error for the approximating
+ *	polynomial is 2**(-28.41).  All calculations are of
+ *	double precision.
+ *	Maximum error observed: less than 0.547 ulp for the
+ *	whole float type range.
+ */
+
+static const double __TBL_logf[] = {
+	/* __TBL_logf[2*i] = log(1+i/32), i = [0, 32] */
+	/* __TBL_logf[2*i+1] = 2**(-23)/(1+i/32), i = [0, 32] */
+0.000000000000000000e+00, 1.192092895507812500e-07, 3.077165866675368733e-02,
+1.155968868371212153e-07, 6.062462181643483994e-02, 1.121969784007352926e-07,
+8.961215868968713805e-02, 1.089913504464285680e-07, 1.177830356563834557e-01,
+1.059638129340277719e-07, 1.451820098444978890e-01, 1.030999260979729787e-07,
+1.718502569266592284e-01, 1.003867701480263102e-07, 1.978257433299198675e-01,
+9.781275040064102225e-08, 2.231435513142097649e-01, 9.536743164062500529e-08,
+2.478361639045812692e-01, 9.304139672256097884e-08, 2.719337154836417580e-01,
+9.082612537202380448e-08, 2.954642128938358980e-01, 8.871388989825581272e-08,
+3.184537311185345887e-01, 8.669766512784091150e-08, 3.409265869705931928e-01,
+8.477105034722222546e-08, 3.629054936893684746e-01, 8.292820142663043248e-08,
+3.844116989103320559e-01, 8.116377160904255122e-08, 4.054651081081643849e-01,
+7.947285970052082892e-08, 4.260843953109000881e-01, 7.785096460459183052e-08,
+4.462871026284195297e-01, 7.629394531250000159e-08, 4.660897299245992387e-01,
+7.479798560049019504e-08, 4.855078157817008244e-01, 7.335956280048077330e-08,
+5.045560107523953119e-01, 7.197542010613207272e-08, 5.232481437645478684e-01,
+7.064254195601851460e-08, 5.415972824327444091e-01, 6.935813210227272390e-08,
+5.596157879354226594e-01, 6.811959402901785336e-08, 5.773153650348236132e-01,
+6.692451343201754014e-08, 5.947071077466927758e-01, 6.577064251077586116e-08,
+6.118015411059929409e-01, 6.465588585805084723e-08, 6.286086594223740942e-01,
+6.357828776041666578e-08, 6.451379613735847007e-01, 6.253602074795082293e-08,
+6.613984822453650159e-01, 6.152737525201612732e-08, 6.773988235918061429e-01,
+6.055075024801586965e-08, 6.931471805599452862e-01, 5.960464477539062500e-08
+};
+
+static const double
+	K3 = -2.49887584306188944706e-01,
+	K2 =  3.33368809981254554946e-01,
+	K1 = -5.00000008402474976565e-01;
+
+static const union {
+	int	i;
+	float	f;
+} inf = { 0x7f800000 };
+
+#define INF	inf.f
+
+#define PROCESS(N)								\
+	u##N = 1.0 + (double) value##N;						\
+	lu##N = *(long long *)&u##N;						\
+	exp##N = (int)(lu##N >> 52) - 1023;					\
+	iy##N = (int)(lu##N >> 32) & 0x000fffff;				\
+	iy##N = (iy##N + 0x4000) & 0x001f8000;					\
+	i##N  = iy##N >> 14;							\
+	lu##N = (lu##N & 0x000fffffffffffffLL) | 0x4160000000000000LL;		\
+	lm##N = (long long)(iy##N + 0x41600000) << 32;				\
+	ty##N = LN2 * (double) exp##N + __TBL_logf[i##N];			\
+	yy##N = (*(double *)&lu##N - *(double *)&lm##N) * __TBL_logf[i##N + 1];	\
+	yy##N = ((K3 * yy##N + K2) * yy##N + K1) * yy##N * yy##N + yy##N;	\
+	y[0] = (float)(yy##N + ty##N);						\
+	y += stridey;
+
+#define PREPROCESS(N, index, label)						\
+	ival = *(int*)x;							\
+	value##N = x[0];							\
+	x += stridex;								\
+	if ( (ival & 0x7fffffff) >= 0x7f800000 ) /* X = NaN or Inf */		\
+	{									\
+		y[index] = value##N + INF;					\
+		goto label;							\
+	}									\
+	if ( (ival & 0x7fffffff) < 0x31000000 )	/* |X| < 2**-29 */		\
+	{									\
+		y[index] = value##N * (1.0f + value##N);			\
+		goto label;							\
+	}									\
+	if ( (unsigned) ival >= 0xbf800000 )	/* X <= -1 */			\
+	{									\
+		value##N = 0.0f;						\
+		y[index] = (ival == 0xbf800000) ?				\
+			-1.0f / value##N : value##N / value##N;			\
+		goto label;							\
+	}
+
+void
+__vlog1pf( int n, float * restrict x, int stridex, float * restrict y,
+	int stridey )
+{
+	double	LN2 = __TBL_logf[64];		/* log(2) = 0.6931471805599453094 	*/
+	double	u0, u1, u2, u3, u4;
+	double	yy0, yy1, yy2, yy3, yy4;
+	double	ty0, ty1, ty2, ty3, ty4;
+	float	value0, value1, value2, value3, value4;
+	long long	lu0, lu1, lu2, lu3, lu4;
+	long long	lm0, lm1, lm2, lm3, lm4;
+	int	i0, i1, i2, i3, i4;
+	int	ival;
+	int	exp0, exp1, exp2, exp3, exp4;
+	int	iy0, iy1, iy2, iy3, iy4;
+
+	y -= stridey;
+
+	for ( ; ; )
+	{
+begin:
+		y += stridey;
+
+		if ( --n < 0 )
+			break;
+
+		PREPROCESS(0, 0, begin)
+
+		if ( --n < 0 )
+			goto process1;
+
+		PREPROCESS(1, stridey, process1)
+
+		if ( --n < 0 )
+			goto process2;
+
+		PREPROCESS(2, (stridey << 1), process2)
+
+		if ( --n < 0 )
+			goto process3;
+
+		PREPROCESS(3, (stridey << 1) + stridey, process3)
+
+		if ( --n < 0 )
+			goto process4;
+
+		PREPROCESS(4, (stridey << 2), process4)
+
+		u0 = 1.0 + (double) value0;
+		u1 = 1.0 + (double) value1;
+		u2 = 1.0 + (double) value2;
+		u3 = 1.0 + (double) value3;
+		u4 = 1.0 + (double) value4;
+
+		lu0 = *(long long *)&u0;
+		lu1 = *(long long *)&u1;
+		lu2 = *(long long *)&u2;
+		lu3 = *(long long *)&u3;
+		lu4 = *(long long *)&u4;
+
+		exp0 = (int)(lu0 >> 52) - 1023;
+		exp1 = (int)(lu1 >> 52) - 1023;
+		exp2 = (int)(lu2 >> 52) - 1023;
+		exp3 = (int)(lu3 >> 52) - 1023;
+		exp4 = (int)(lu4 >> 52) - 1023;
+
+		iy0 = (int)(lu0 >> 32) & 0x000fffff;
+		iy1 = (int)(lu1 >> 32) & 0x000fffff;
+		iy2 = (int)(lu2 >> 32) & 0x000fffff;
+		iy3 = (int)(lu3 >> 32) & 0x000fffff;
+		iy4 = (int)(lu4 >> 32) & 0x000fffff;
+
+		iy0 = (iy0 + 0x4000) & 0x001f8000;
+		iy1 = (iy1 + 0x4000) & 0x001f8000;
+		iy2 = (iy2 + 0x4000) & 0x001f8000;
+		iy3 = (iy3 + 0x4000) & 0x001f8000;
+		iy4 = (iy4 + 0x4000) & 0x001f8000;
+
+		i0 = iy0 >> 14;
+		i1 = iy1 >> 14;
+		i2 = iy2 >> 14;
+		i3 = iy3 >> 14;
+		i4 = iy4 >> 14;
+
+		lu0 = (lu0 & 0x000fffffffffffffLL) | 0x4160000000000000LL;
+		lu1 = (lu1 & 0x000fffffffffffffLL) | 0x4160000000000000LL;
+		lu2 = (lu2 & 0x000fffffffffffffLL) | 0x4160000000000000LL;
+		lu3 = (lu3 & 0x000fffffffffffffLL) | 0x4160000000000000LL;
+		lu4 = (lu4 & 0x000fffffffffffffLL) | 0x4160000000000000LL;
+
+		lm0 = (long long)(iy0 + 0x41600000) << 32;
+		lm1 = (long long)(iy1 + 0x41600000) << 32;
+		lm2 = (long long)(iy2 + 0x41600000) << 32;
+		lm3 = (long long)(iy3 + 0x41600000) << 32;
+		lm4 = (long long)(iy4 + 0x41600000) << 32;
+
+		ty0 = LN2 * (double) exp0 + __TBL_logf[i0];
+		ty1 = LN2 * (double) exp1 + __TBL_logf[i1];
+		ty2 = LN2 * (double) exp2 + __TBL_logf[i2];
+		ty3 = LN2 * (double) exp3 + __TBL_logf[i3];
+		ty4 = LN2 * (double) exp4 + __TBL_logf[i4];
+
+		yy0 = (*(double *)&lu0 - *(double *)&lm0) * __TBL_logf[i0 + 1];
+		yy1 = (*(double *)&lu1 - *(double *)&lm1) * __TBL_logf[i1 + 1];
+		yy2 = (*(double *)&lu2 - *(double *)&lm2) * __TBL_logf[i2 + 1];
+		yy3 = (*(double *)&lu3 - *(double *)&lm3) * __TBL_logf[i3 + 1];
+		yy4 = (*(double *)&lu4 - *(double *)&lm4) * __TBL_logf[i4 + 1];
+
+		yy0 = ((K3 * yy0 + K2) * yy0 + K1) * yy0 * yy0 + yy0;
+		yy1 = ((K3 * yy1 + K2) * yy1 + K1) * yy1 * yy1 + yy1;
+		yy2 = ((K3 * yy2 + K2) * yy2 + K1) * yy2 * yy2 + yy2;
+		yy3 = ((K3 * yy3 + K2) * yy3 + K1) * yy3 * yy3 + yy3;
+		yy4 = ((K3 * yy4 + K2) * yy4 + K1) * yy4 * yy4 + yy4;
+
+		y[0] = (float)(yy0 + ty0);
+		y += stridey;
+		y[0] = (float)(yy1 + ty1);
+		y += stridey;
+		y[0] = (float)(yy2 + ty2);
+		y += stridey;
+		y[0] = (float)(yy3 + ty3);
+		y += stridey;
+		y[0] = (float)(yy4 + ty4);
+		continue;
+
+process1:
+		PROCESS(0)
+		continue;
+
+process2:
+		PROCESS(0)
+		PROCESS(1)
+		continue;
+
+process3:
+		PROCESS(0)
+		PROCESS(1)
+		PROCESS(2)
+		continue;
+
+process4:
+		PROCESS(0)
+		PROCESS(1)
+		PROCESS(2)
+		PROCESS(3)
+	}
+}
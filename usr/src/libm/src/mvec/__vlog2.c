@@ -0,0 +1,777 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vlog2: double precision vector log2
+ *
+ * Algorithm:
+ *
+ * This is __vlog with the tables and coefficients rescaled by
+ * 1/log(2).  Write x = 2^n z where 1 - 2^-10 <= z < 2 - 2^-9.
+ * Let m = z rounded to nine significant bits, so m = 1 + 2^-8 k,
+ * where 0 <= k <= 255.  Let d = z - m.  Then
+ *
+ * log2(x) = n + log2(m) + log2(1+(d/m))
+ *
+ * From a table, obtain mh and ml such that mh = log2(m) rounded
+ * to a multiple of 2^-42 and ml ~ log2(m) - mh.  From the same
+ * table, obtain rh and rl such that rh = 1/(m log(2)) rounded to
+ * ten significant bits and rl ~ 1/(m log(2)) - rh, so that d*rh
+ * is exact.  Let s = d*rh + d*rl in double precision; then
+ * log2(1+(d/m)) ~ s + p(s), where p(s) := s*s*(P2+s*(P3+s*(P4+
+ * s*(P5+s*P6)))) and Pj is the coefficient of the __vlog
+ * polynomial divided by log(2)^(j-1).  Since n + mh is exact,
+ * we can compute the sum above accurately as
+ *
+ * (n + mh) + (d*rh + (d*rl + ml + p(s)))
+ *
+ * When x is subnormal, we first scale it to the normal range,
+ * adjusting n accordingly.
+ *
+ * Accuracy:
+ *
+ * The largest error observed is less than 0.76 ulps.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)&x)
+#define	LO(x)	*(unsigned *)&x
+#define	HIWORD	1
+#define	LOWORD	0
+#else
+#define	HI(x)	*(int *)&x
+#define	LO(x)	*(1+(unsigned *)&x)
+#define	HIWORD	0
+#define	LOWORD	1
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+static const double TBL[] = {
+	1.44335937500000000000e+00, -6.64334111036592612348e-04,
+	0.00000000000000000000e+00,  0.00000000000000000000e+00,
+	1.43750000000000000000e+00, -4.18558491927500822636e-04,
+	5.62454919395349861588e-03, -7.53916960241880959458e-14,
+	1.43164062500000000000e+00, -1.29266598547936886971e-04,
+	1.12272554233641130850e-02, -1.09992747091320341080e-13,
+	1.42578125000000000000e+00,  2.03037519593174842648e-04,
+	1.68082876864446006948e-02,  1.09288604960660578790e-13,
+	1.41992187500000000000e+00,  5.77857567594739526644e-04,
+	2.23678130284952203510e-02, -4.07120839008289835209e-14,
+	1.41601562500000000000e+00, -9.58420143392213442698e-04,
+	2.79059965698706946569e-02,  1.37889703948544729435e-14,
+	1.41015625000000000000e+00, -5.00026841318197386513e-04,
+	3.34230015373577771243e-02,  9.25018933239073765668e-14,
+	1.40429687500000000000e+00, -5.61435077443786513835e-07,
+	3.89189892923695879290e-02, -6.72370104066368140846e-14,
+	1.39843750000000000000e+00,  5.39509346873607176925e-04,
+	4.43941193584578286391e-02, -4.39098597316935273755e-15,
+	1.39453125000000000000e+00, -8.33399178963651807682e-04,
+	4.98485494506439863471e-02, -8.24591960339830699731e-14,
+	1.38867187500000000000e+00, -2.13489783554013964721e-04,
+	5.52824355011125589954e-02,  7.70422401151930600187e-14,
+	1.38281250000000000000e+00,  4.45666545223341896073e-04,
+	6.06959316876327648060e-02, -7.88283880205416762167e-14,
+	1.37890625000000000000e+00, -8.09494523975252630067e-04,
+	6.60891904576601518784e-02,  1.12281050905174017945e-13,
+	1.37304687500000000000e+00, -7.31557896853818372595e-05,
+	7.14623625565309339436e-02,  9.32106841783956977868e-14,
+	1.36718750000000000000e+00,  7.01131361387527019847e-04,
+	7.68155970508814789355e-02, -5.05867039438564623684e-14,
+	1.36328125000000000000e+00, -4.40178163931246181195e-04,
+	8.21490413538867869647e-02, -1.52262670495247398489e-14,
+	1.35742187500000000000e+00,  4.08751719024383385406e-04,
+	8.74628412502715946175e-02,  6.78136365502084236120e-14,
+	1.35351562500000000000e+00, -6.58736840385962360740e-04,
+	9.27571409199572372017e-02, -1.04787909221912459312e-13,
+	1.34765625000000000000e+00,  2.63204261221285714268e-04,
+	9.80320829605716426158e-02, -4.49268201807677058008e-14,
+	1.34375000000000000000e+00, -7.32071027001337192551e-04,
+	1.03287808412005688297e-01,  1.62636433709271201444e-14,
+	1.33789062500000000000e+00,  2.61296983966059022299e-04,
+	1.08524456778241074062e-01, -7.20203140653432285089e-14,
+	1.33398437500000000000e+00, -6.63326380596995324006e-04,
+	1.13742166049178194953e-01,  1.01349616545169684512e-14,
+	1.32812500000000000000e+00,  3.99929739477094560712e-04,
+	1.18941072723600882455e-01, -9.34514650420506818397e-14,
+	1.32421875000000000000e+00, -4.55558359947554514409e-04,
+	1.24121311829185287934e-01,  2.28377980484286032917e-15,
+	1.31835937500000000000e+00,  6.76090955623686695568e-04,
+	1.29283016945009876508e-01, -4.34211959769869950205e-14,
+	1.31445312500000000000e+00, -1.11735435677465187710e-04,
+	1.34426320220882189460e-01,  4.39092349214998246312e-14,
+	1.31054687500000000000e+00, -8.66270505054495443438e-04,
+	1.39551352398711969727e-01,  8.15838978307359802664e-14,
+	1.30468750000000000000e+00,  3.65257835952764275782e-04,
+	1.44658242831837924314e-01,  4.43965028643840855853e-14,
+	1.30078125000000000000e+00, -3.23748353610449682554e-04,
+	1.49747119504581860383e-01,  1.00201023705588600148e-13,
+	1.29492187500000000000e+00,  9.72617868682920248997e-04,
+	1.54818109052030195016e-01,  7.38281011638692622855e-14,
+	1.29101562500000000000e+00,  3.47768243267945048863e-04,
+	1.59871336778451222926e-01, -6.18063302025491458365e-14,
+	1.28710937500000000000e+00, -2.45505775001281223695e-04,
+	1.64906926675712384167e-01, -2.45835591866864741753e-14,
+	1.28320312500000000000e+00, -8.07533098699193493432e-04,
+	1.69925001442379652872e-01, -6.72899642724072672134e-14,
+	1.27734375000000000000e+00,  6.14486912022949049485e-04,
+	1.74925682500770562910e-01, -9.17464023428151996329e-14,
+	1.27343750000000000000e+00,  1.13984370947007877177e-04,
+	1.79909090014916728251e-01,  1.77403394104001441359e-14,
+	1.26953125000000000000e+00, -3.56231211083737875876e-04,
+	1.84875342908298989641e-01, -1.51283615222750110355e-14,
+	1.26562500000000000000e+00, -7.96471001456738793983e-04,
+	1.89824558879990945570e-01,  2.62842938462887954667e-14,
+	1.25976562500000000000e+00,  7.46083080459495869355e-04,
+	1.94756854422166725271e-01,  8.11492585140355436249e-14,
+	1.25585937500000000000e+00,  3.64878291070177846606e-04,
+	1.99672344836471893359e-01, -1.07497021298070470811e-13,
+	1.25195312500000000000e+00,  1.27409917784145227808e-05,
+	2.04571144249257486081e-01, -5.38794030244615985625e-14,
+	1.24804687500000000000e+00, -3.10623420355972033012e-04,
+	2.09453365628860410652e-01,  8.93712056807859825227e-14,
+	1.24414062500000000000e+00, -6.05505580556793608464e-04,
+	2.14319120800837481511e-01, -7.16809502455766246841e-14,
+	1.24023437500000000000e+00, -8.72192222903918562907e-04,
+	2.19168520462062588194e-01,  9.89834174352711905636e-14,
+	1.23437500000000000000e+00,  8.42158754430208269896e-04,
+	2.24001674198007094674e-01,  9.79380171485090426040e-14,
+	1.23046875000000000000e+00,  6.31018225248774285337e-04,
+	2.28818690495927512529e-01, -4.66353349283107927537e-14,
+	1.22656250000000000000e+00,  4.47235772673196946281e-04,
+	2.33619676759644789854e-01,  5.72564720463739185333e-14,
+	1.22265625000000000000e+00,  2.90539627730570463454e-04,
+	2.38404739325005721184e-01,  7.31853584762284918547e-14,
+	1.21875000000000000000e+00,  1.60661609157202258952e-04,
+	2.43173983472843247000e-01,  1.07671625270026659875e-13,
+	1.21484375000000000000e+00,  5.73370643902377740927e-05,
+	2.47927513443528368953e-01,  5.71248408353184637514e-14,
+	1.21093750000000000000e+00, -1.96951882798941511248e-05,
+	2.52665432450157823041e-01,  9.08013014402239428729e-14,
+	1.20703125000000000000e+00, -7.06929164227703180599e-05,
+	2.57387842692651247489e-01,  5.23672277801160441574e-16,
+	1.20312500000000000000e+00, -9.59105290728590046453e-05,
+	2.62094845370256734896e-01, -7.73467702751548549043e-14,
+	1.19921875000000000000e+00, -9.55991312511938773908e-05,
+	2.66786540694965879084e-01, -6.45154422787071573361e-14,
+	1.19531250000000000000e+00, -7.00065774283744907819e-05,
+	2.71463027904474074603e-01, -9.95120884466403972925e-14,
+	1.19140625000000000000e+00, -1.93775239527990832968e-05,
+	2.76124405274231321528e-01,  6.23514882038853191603e-15,
+	1.18750000000000000000e+00,  5.60465195325796886223e-05,
+	2.80770770130629898631e-01, -2.73574765598362131476e-14,
+	1.18359375000000000000e+00,  1.56027139662282975010e-04,
+	2.85402218862145673484e-01,  1.02668366941445003900e-13,
+	1.17968750000000000000e+00,  2.80328969887004087261e-04,
+	2.90018846932525775628e-01,  9.25585593806985295389e-14,
+	1.17578125000000000000e+00,  4.28719641957427631800e-04,
+	2.94620748891702533001e-01, -7.55265910394270876612e-14,
+	1.17187500000000000000e+00,  6.00969738332165939569e-04,
+	2.99208018387389529380e-01, -1.10711160249394268545e-13,
+	1.16796875000000000000e+00,  7.96852745489342695166e-04,
+	3.03780748177132409182e-01, -2.94847550908176559001e-14,
+	1.16601562500000000000e+00, -9.36979991878131605529e-04,
+	3.08339030139450187562e-01, -4.29332108212246458054e-14,
+	1.16210937500000000000e+00, -6.94499315803043118858e-04,
+	3.12882955284294439480e-01,  6.09212548082909237582e-14,
+	1.15820312500000000000e+00, -4.29048299139083745557e-04,
+	3.17412613764872730826e-01, -3.35390689132001068553e-15,
+	1.15429687500000000000e+00, -1.40842288829274100721e-04,
+	3.21928094887425686466e-01, -6.33385952568615975986e-14,
+	1.15039062500000000000e+00,  1.69906051634368488942e-04,
+	3.26429487122368300334e-01, -6.51710152820391314352e-14,
+	1.14648437500000000000e+00,  5.02986700542336242874e-04,
+	3.30916878114521750831e-01,  9.52289050723510311044e-14,
+	1.14257812500000000000e+00,  8.58192237073164944719e-04,
+	3.35390354694027337246e-01, -1.02435198057705172115e-13,
+	1.14062500000000000000e+00, -7.17807198843727501530e-04,
+	3.39850002884531932068e-01,  9.27937468984175250520e-14,
+	1.13671875000000000000e+00, -3.18963945924208335317e-04,
+	3.44295907915920906817e-01, -1.04050679157690574809e-13,
+	1.13281250000000000000e+00,  1.01397139799485537406e-04,
+	3.48728154231139342301e-01, -6.17897368128812066579e-14,
+	1.12890625000000000000e+00,  5.43078647017224093105e-04,
+	3.53146825498015459743e-01,  6.70801891973541167946e-14,
+	1.12695312500000000000e+00, -9.47239428126121036852e-04,
+	3.57552004618128194124e-01, -4.45009584665610704426e-14,
+	1.12304687500000000000e+00, -4.63499718618138928285e-04,
+	3.61943773735220020171e-01,  2.14594415251981867119e-14,
+	1.11914062500000000000e+00,  4.09824774988857090142e-05,
+	3.66322214245883515105e-01, -6.77295812300309424476e-14,
+	1.11523437500000000000e+00,  5.66019161856895144935e-04,
+	3.70687406807292063604e-01, -7.43659933058151558924e-14,
+	1.11328125000000000000e+00, -8.41700398871589533858e-04,
+	3.75039431346976925852e-01, -5.21694921496085088670e-14,
+	1.10937500000000000000e+00, -2.76109706983086245543e-04,
+	3.79378367071240063524e-01,  2.20812414083787184647e-14,
+	1.10546875000000000000e+00,  3.09484932858180466272e-04,
+	3.83704292474021713133e-01,  3.05113383502165087994e-14,
+	1.10156250000000000000e+00,  9.14904380819797809210e-04,
+	3.88017285345085838344e-01,  4.89424556483124203464e-14,
+	1.09960937500000000000e+00, -4.13153370313594384220e-04,
+	3.92317422778660329641e-01,  9.99592548652869924000e-14,
+	1.09570312500000000000e+00,  2.31386773218493420638e-04,
+	3.96604781181849830318e-01,  8.63479414580400001393e-15,
+	1.09179687500000000000e+00,  8.95226975072876550617e-04,
+	4.00879436282139067771e-01,  4.52530227120652218447e-14,
+	1.08984375000000000000e+00, -3.74928561726748407583e-04,
+	4.05141463136260426836e-01,  8.34629361957600809126e-14,
+	1.08593750000000000000e+00,  3.27001375219506719167e-04,
+	4.09390936137697281083e-01,  4.47504129334683232426e-15,
+	1.08398437500000000000e+00, -9.05400021775271904995e-04,
+	4.13627929024187324103e-01, -1.48590974813316232999e-14,
+	1.08007812500000000000e+00, -1.66047609430899765397e-04,
+	4.17852514885908021824e-01, -1.01651234370888018842e-14,
+	1.07617187500000000000e+00,  5.91770678060152439948e-04,
+	4.22064766172752570128e-01,  5.97521978396237888019e-14,
+	1.07421875000000000000e+00, -5.85231198910952672004e-04,
+	4.26264754702060599811e-01,  3.73390727664993222660e-14,
+	1.07031250000000000000e+00,  2.09037587172847206998e-04,
+	4.30452551665439386852e-01,  9.20147661210272333712e-14,
+	1.06835937500000000000e+00, -9.31830296027074300898e-04,
+	4.34628227636721931049e-01,  2.70167272015910642257e-15,
+	1.06445312500000000000e+00, -1.01740367220079877021e-04,
+	4.38791852578333418933e-01, -7.25114092862764017600e-14,
+	1.06054687500000000000e+00,  7.46028642455839863766e-04,
+	4.42943495848794555059e-01, -6.62528851905579216115e-14,
+	1.05859375000000000000e+00, -3.41800236175838719789e-04,
+	4.47083226209542772267e-01,  1.09458340642223366933e-13,
+	1.05468750000000000000e+00,  5.40872764498949356454e-04,
+	4.51211111832435562974e-01, -1.06759791233848586308e-13,
+	1.05273437500000000000e+00, -5.12350875855748454611e-04,
+	4.55327220304525326355e-01,  3.53784026690377366862e-14,
+	1.04882812500000000000e+00,  4.04632010155205328484e-04,
+	4.59431618637381689041e-01, -8.44328415585817536034e-14,
+	1.04687500000000000000e+00, -6.14573746247500628248e-04,
+	4.63524373271184231271e-01, -3.94104161672887657730e-15,
+	1.04296875000000000000e+00,  3.36138326482012092435e-04,
+	4.67605550082907939213e-01,  8.95010478178123951688e-14,
+	1.04101562500000000000e+00, -6.49623682888359789411e-04,
+	4.71675214392007546849e-01,  3.68624284487270088599e-14,
+	1.03710937500000000000e+00,  3.34249908917506422055e-04,
+	4.75733430966329251532e-01,  6.85034318372779871293e-14,
+	1.03515625000000000000e+00, -6.18629642648088813074e-04,
+	4.79780264029159297934e-01, -5.96007840277366434668e-14,
+	1.03125000000000000000e+00,  3.97850468085565039944e-04,
+	4.83815777264226198895e-01,  3.02251967405877624621e-14,
+	1.02929687500000000000e+00, -5.22695424583196938291e-04,
+	4.87840033822976693045e-01,  7.46523053962589794215e-14,
+	1.02539062500000000000e+00,  5.25848521040645183570e-04,
+	4.91853096329577965662e-01,  9.67451159139631946668e-14,
+	1.02343750000000000000e+00, -3.62900366829273430570e-04,
+	4.95855026887284111581e-01, -1.13123993772595131976e-13,
+	1.01953125000000000000e+00,  7.17176706007271449680e-04,
+	4.99845887083210982382e-01, -5.62184872960285888646e-15,
+	1.01757812500000000000e+00, -1.40300020455558438958e-04,
+	5.03825737995839517680e-01, -8.88238275317510984524e-14,
+	1.01367187500000000000e+00,  9.70791119710528202340e-04,
+	5.07794640198653723928e-01,  4.25439106359072040342e-14,
+	1.01171875000000000000e+00,  1.44073198834609002760e-04,
+	5.11752653767416632036e-01, -3.70543014105727989765e-14,
+	1.00976562500000000000e+00, -6.67454323566578420872e-04,
+	5.15699838284035649849e-01,  6.80807683926587870319e-15,
+	1.00585937500000000000e+00,  4.89209380312349536093e-04,
+	5.19636252843156398740e-01,  5.63715970340694952911e-14,
+	1.00390625000000000000e+00, -2.92308512025455746828e-04,
+	5.23561956056937560788e-01,  7.53115057924764348371e-14,
+	1.00000000000000000000e+00,  8.94120508332336819991e-04,
+	5.27477006060507846996e-01, -1.11790922738968337656e-13,
+	9.98046875000000000000e-01,  1.42126263715222389853e-04,
+	5.31381460516286097118e-01,  2.60326104239243912349e-14,
+	9.95117187500000000000e-01,  3.81277372168820191580e-04,
+	5.35275376620802489924e-01,  7.96798502753118863828e-16,
+	9.93164062500000000000e-01, -3.41668769960665912912e-04,
+	5.39158811108109148336e-01, -7.77580757805695361980e-14,
+	9.90234375000000000000e-01, -7.37035051618437477092e-05,
+	5.43031820255237107631e-01,  6.69404724421099777325e-16,
+	9.87304687500000000000e-01,  2.08495568381369749626e-04,
+	5.46894459887653283658e-01, -1.66192050083733236805e-14,
+	9.85351562500000000000e-01, -4.71747919800980560889e-04,
+	5.50746785383353198995e-01, -1.09973930185172384041e-13,
+	9.82421875000000000000e-01, -1.61421628790871582579e-04,
+	5.54588851677635830129e-01,  1.54204224532358945854e-15,
+	9.79492187500000000000e-01,  1.62800477651544510480e-04,
+	5.58420713268560575671e-01,  1.03705446023294349501e-13,
+	9.77539062500000000000e-01, -4.75754384723195032289e-04,
+	5.62242424221039982513e-01,  3.26692905928797251866e-14,
+	9.74609375000000000000e-01, -1.24070336214690551827e-04,
+	5.66054038171159845660e-01, -6.81463062083114837163e-14,
+	9.71679687500000000000e-01,  2.41182151512190213853e-04,
+	5.69855608330954055418e-01, -6.21375442154313069179e-15,
+	9.69726562500000000000e-01, -3.56666259646634437215e-04,
+	5.73647187493406818248e-01, -8.47835145887105399616e-14,
+	9.66796875000000000000e-01,  3.54037109283567653960e-05,
+	5.77428828035635888227e-01,  1.12801031516142167320e-13,
+	9.63867187500000000000e-01,  4.40724947975541195711e-04,
+	5.81200581925031656283e-01, -7.45714460047089911917e-14,
+	9.61914062500000000000e-01, -1.17368574024395092969e-04,
+	5.84962500721076139598e-01,  8.00418555854123961327e-14,
+	9.58984375000000000000e-01,  3.14145694999044908929e-04,
+	5.88714635582164191874e-01,  9.95196379076633171658e-14,
+	9.57031250000000000000e-01, -2.17958633226341238001e-04,
+	5.92457037268104613759e-01, -2.41941213190231741867e-14,
+	9.54101562500000000000e-01,  2.39343100968042075353e-04,
+	5.96189756144440252683e-01, -2.99508915059079449474e-14,
+	9.52148437500000000000e-01, -2.67173408312803379802e-04,
+	5.99912842187222850043e-01, -9.51702171076874071682e-14,
+	9.49218750000000000000e-01,  2.15518554176432600069e-04,
+	6.03626344986196272657e-01, -4.34009384384882473103e-15,
+	9.47265625000000000000e-01, -2.65803288270173630834e-04,
+	6.07330313749571359949e-01,  3.93297716845834126118e-14,
+	9.44335937500000000000e-01,  2.41889782799571055431e-04,
+	6.11024797307436529081e-01, -8.42485331005472010296e-14,
+	9.42382812500000000000e-01, -2.14622531697366615046e-04,
+	6.14709844115168380085e-01,  3.98347985597491925346e-14,
+	9.39453125000000000000e-01,  3.17690439121201724255e-04,
+	6.18385502258661290398e-01, -5.48299265339122804683e-14,
+	9.37500000000000000000e-01, -1.14389676206517042103e-04,
+	6.22051819456373777939e-01,  2.48884479478282575819e-15,
+	9.34570312500000000000e-01,  4.42169696391474123607e-04,
+	6.25708843064558095648e-01, -9.28233503476792534987e-14,
+	9.32617187500000000000e-01,  3.41520645824047597706e-05,
+	6.29356620079533968237e-01,  7.56508696122430386620e-14,
+	9.30664062500000000000e-01, -3.61970642129389732437e-04,
+	6.32995197142918186728e-01,  3.95992674667100436716e-14,
+	9.27734375000000000000e-01,  2.30274416016664027363e-04,
+	6.36624620543670971529e-01, -2.21329709125781672768e-14,
+	9.25781250000000000000e-01, -1.42326522369342652182e-04,
+	6.40244936222416072269e-01, -7.02895797426266033274e-14,
+	9.22851562500000000000e-01,  4.73263668936580686897e-04,
+	6.43856189774623999256e-01,  1.00696484929508864281e-13,
+	9.20898437500000000000e-01,  1.23832992704818673282e-04,
+	6.47458426454932123306e-01, -1.18254601892272904684e-14,
+	9.18945312500000000000e-01, -2.14142182650168438115e-04,
+	6.51051691178963665152e-01, -3.50507689526456517119e-14,
+	9.16015625000000000000e-01,  4.35815366190154575288e-04,
+	6.54636028527875168948e-01,  9.22002554332827349150e-14,
+	9.14062500000000000000e-01,  1.20496206867901694214e-04,
+	6.58211482751767107402e-01,  2.76297696846142637422e-14,
+	9.12109375000000000000e-01, -1.83620759074982022908e-04,
+	6.61778097771957618534e-01,  2.94551516415559337643e-14,
+	9.10156250000000000000e-01, -4.76618306466422927449e-04,
+	6.65335917185075231828e-01,  1.00996333947136338002e-13,
+	9.07226562500000000000e-01,  2.17984103377474907259e-04,
+	6.68884984266242099693e-01,  4.93836412220423523013e-15,
+	9.05273437500000000000e-01, -5.30196873170777317687e-05,
+	6.72425341971575107891e-01, -7.95181833076112397340e-14,
+	9.03320312500000000000e-01, -3.13147542604811019492e-04,
+	6.75957032941823854344e-01, -7.50320918957106939196e-14,
+	9.00390625000000000000e-01,  4.14083457499103148834e-04,
+	6.79480099505553880590e-01, -1.07839553723422668041e-13,
+	8.98437500000000000000e-01,  1.75469507480857151880e-04,
+	6.82994583681647782214e-01,  3.51150354046446903319e-14,
+	8.96484375000000000000e-01, -5.25049330712808613101e-05,
+	6.86500527183170561329e-01,  4.78197314111792723644e-14,
+	8.94531250000000000000e-01, -2.69917148729703897537e-04,
+	6.89997971419415989658e-01,  2.93765915122745953034e-14,
+	8.92578125000000000000e-01, -4.76843677355960669870e-04,
+	6.93486957499317213660e-01,  8.02154152006916920151e-15,
+	8.89648437500000000000e-01,  3.03202180902728372913e-04,
+	6.96967526234175238642e-01,  1.11865588036761959324e-13,
+	8.87695312500000000000e-01,  1.17020354746712217705e-04,
+	7.00439718141069533885e-01,  2.26265113560326109223e-14,
+	8.85742187500000000000e-01, -5.89010070152702996352e-05,
+	7.03903573444677022053e-01, -1.34096094566382825515e-14,
+	8.83789062500000000000e-01, -2.24635544079827083244e-04,
+	7.07359132080910057994e-01, -2.73080007232632866966e-14,
+	8.81835937500000000000e-01, -3.80256193139302442995e-04,
+	7.10806433699417539174e-01, -6.59422422828259660118e-14,
+	8.78906250000000000000e-01,  4.50727303749124481782e-04,
+	7.14245517666086016106e-01,  3.66206596084254011122e-14,
+	8.76953125000000000000e-01,  3.15118390913615850028e-04,
+	7.17676423066450297483e-01, -5.42176845865495888980e-14,
+	8.75000000000000000000e-01,  1.89408690935147596725e-04,
+	7.21099188707285065902e-01, -9.99317434849560075891e-14,
+	8.73046875000000000000e-01,  7.35279966303363665238e-05,
+	7.24513853120015483000e-01, -6.57479220270836830796e-14,
+	8.71093750000000000000e-01, -3.25932368522823459199e-05,
+	7.27920454563218299882e-01, -1.91206007771214786854e-14,
+	8.69140625000000000000e-01, -1.29023899824394630087e-04,
+	7.31319031025122967549e-01, -5.88635539635147589635e-14,
+	8.67187500000000000000e-01, -2.15832235740299815474e-04,
+	7.34709620225885373657e-01, -4.71307961522310568875e-14,
+	8.65234375000000000000e-01, -2.93085848771352955409e-04,
+	7.38092259620543700294e-01, -5.33163794662719227399e-14,
+	8.63281250000000000000e-01, -3.60851711274223633293e-04,
+	7.41466986401064787060e-01,  8.21608045757805319109e-14,
+	8.61328125000000000000e-01, -4.19196171154703300758e-04,
+	7.44833837499527362525e-01,  1.82355253828632566071e-14,
+	8.59375000000000000000e-01, -4.68184959128762105077e-04,
+	7.48192849589486286277e-01, -2.59995224903622721772e-14,
+	8.56445312500000000000e-01,  4.68679304117476322206e-04,
+	7.51544059089155780384e-01, -5.76443975527312633678e-14,
+	8.54492187500000000000e-01,  4.38207100867204373852e-04,
+	7.54887502163455792470e-01,  1.27518913130051304971e-14,
+	8.52539062500000000000e-01,  4.16897009410236211134e-04,
+	7.58223214726740479819e-01, -1.55744312894408071658e-14,
+	8.50585937500000000000e-01,  4.04685697176572066903e-04,
+	7.61551232444389825105e-01,  8.94911433571247234154e-14,
+	8.48632812500000000000e-01,  4.01510413964671891013e-04,
+	7.64871590735992867849e-01,  9.77821949958125402686e-14,
+	8.46679687500000000000e-01,  4.07308985262918069829e-04,
+	7.68184324776939320145e-01, -1.29616663880582809158e-14,
+	8.44726562500000000000e-01,  4.22019805662774110788e-04,
+	7.71489469500693303416e-01, -9.49373288154371608902e-14,
+	8.42773437500000000000e-01,  4.45581832362174155415e-04,
+	7.74787059601067085168e-01,  1.06326149431701194755e-13,
+	8.40820312500000000000e-01,  4.77934578757704530295e-04,
+	7.78077129535404310445e-01, -4.61263332238807685454e-14,
+	8.39843750000000000000e-01, -4.57544391875835704687e-04,
+	7.81359713524580001831e-01,  7.96022386277887208985e-14,
+	8.37890625000000000000e-01, -4.07789472619881417526e-04,
+	7.84634845557548032957e-01, -2.74551657126580715233e-14,
+	8.35937500000000000000e-01, -3.49422019061917899993e-04,
+	7.87902559391341128503e-01,  9.04401479062410313789e-14,
+	8.33984375000000000000e-01, -2.82500355362003856882e-04,
+	7.91162888554936216678e-01,  8.20902802038674004338e-14,
+	8.32031250000000000000e-01, -2.07082280237314670605e-04,
+	7.94415866350163923926e-01, -5.79606141770336808234e-14,
+	8.30078125000000000000e-01, -1.23225072865994867777e-04,
+	7.97661525853754937998e-01,  5.16483658041638953070e-15,
+	8.28125000000000000000e-01, -3.09854987115868067758e-05,
+	8.00899899920295865741e-01,  8.86729222621185301558e-15,
+	8.26171875000000000000e-01,  6.95801847307209896847e-05,
+	8.04131021183366101468e-01, -4.83484024225484790934e-14,
+	8.24218750000000000000e-01,  1.78416222264804198282e-04,
+	8.07354922057584190043e-01,  1.99173992798745962673e-14,
+	8.22265625000000000000e-01,  2.95467355400071888909e-04,
+	8.10571634741108937305e-01,  3.80051025642438998474e-14,
+	8.20312500000000000000e-01,  4.20678816832516190224e-04,
+	8.13781191217003652127e-01,  3.34065206571016033790e-14,
+	8.19335937500000000000e-01, -4.22566175000815358667e-04,
+	8.16983623255282509490e-01,  9.84398754180892354328e-14,
+	8.17382812500000000000e-01, -2.81196421295061332792e-04,
+	8.20178962415184287238e-01,  3.42108061034768123001e-15,
+	8.15429687500000000000e-01, -1.31827748179619681996e-04,
+	8.23367240046309234458e-01, -7.41464613815911714914e-14,
+	8.13476562500000000000e-01,  2.54869880498508456996e-05,
+	8.26548487290892808232e-01,  2.21755496317744428786e-14,
+	8.11523437500000000000e-01,  1.90695395768422594398e-04,
+	8.29722735086079410394e-01, -2.07946846209543872536e-14,
+	8.09570312500000000000e-01,  3.63745542926825196281e-04,
+	8.32890014164831882226e-01, -9.02069790225011995946e-14,
+	8.08593750000000000000e-01, -4.31976547976734611810e-04,
+	8.36050355057977867546e-01,  9.18328951123449894717e-14,
+	8.06640625000000000000e-01, -2.43396904858881479470e-04,
+	8.39203788096938296803e-01,  5.64190041472262660156e-15,
+	8.04687500000000000000e-01, -4.71286109485135408558e-05,
+	8.42350343413727387087e-01,  8.05655278632135525314e-14,
+	8.02734375000000000000e-01,  1.56778190379635391696e-04,
+	8.45490050944363247254e-01,  1.19729105356148403939e-14,
+	8.00781250000000000000e-01,  3.68273790834343340249e-04,
+	8.48622940429322625278e-01,  1.53517991100686199156e-14,
+	7.99804687500000000000e-01, -3.89253587500795945366e-04,
+	8.51749041416042018682e-01,  1.55264133067052451075e-14,
+	7.97851562500000000000e-01, -1.62727796815049071061e-04,
+	8.54868383260281916591e-01, -4.55301916593546325837e-14,
+	7.95898437500000000000e-01,  7.12402318418799249296e-05,
+	8.57980995127491041785e-01,  8.10789346672617417346e-14,
+	7.93945312500000000000e-01,  3.12602484031467291355e-04,
+	8.61086905995307461126e-01,  8.62770044058009256822e-14,
+	7.92968750000000000000e-01, -4.15251142543707522318e-04,
+	8.64186144654240706586e-01,  3.95304321767020416536e-14,
+	7.91015625000000000000e-01, -1.59242842452607516251e-04,
+	8.67278739709718138329e-01, -5.62250624243786005811e-14,
+	7.89062500000000000000e-01,  1.04018093108188645489e-04,
+	8.70364719583449186757e-01, -4.46634529163746594465e-14,
+	7.87109375000000000000e-01,  3.74485272014141331014e-04,
+	8.73444112515471715597e-01, -9.51752252581834452664e-14,
+	7.86132812500000000000e-01, -3.24449803032697287747e-04,
+	8.76516946565061516594e-01, -6.17965530115380008431e-14,
+	7.84179687500000000000e-01, -3.97077386950482296552e-05,
+	8.79583249612778672599e-01,  4.51526454598530531605e-15,
+	7.82226562500000000000e-01,  2.52103744861509055774e-04,
+	8.82643049361831799615e-01,  9.45919223239999588069e-15,
+	7.81250000000000000000e-01, -4.25622690117056503515e-04,
+	8.85696373339442288852e-01, -4.70937687920824250265e-14,
+	7.79296875000000000000e-01, -1.19806503007104892477e-04,
+	8.88743248898208548781e-01,  5.05571004945947402326e-14,
+	7.77343750000000000000e-01,  1.92945721209752187346e-04,
+	8.91783703218379741884e-01, -6.95523496784047314459e-14,
+	7.76367187500000000000e-01, -4.63972231986066636911e-04,
+	8.94817763307855784660e-01,  8.77310358300830198793e-14,
+	7.74414062500000000000e-01, -1.37478710535362088274e-04,
+	8.97845456005597952753e-01, -8.64105650495287395878e-14,
+	7.72460937500000000000e-01,  1.95820800365339493408e-04,
+	9.00866807980719386251e-01,  2.91720916075527743938e-14,
+	7.71484375000000000000e-01, -4.40678825522688359748e-04,
+	9.03881845736123068491e-01,  5.71753519579269742327e-14,
+	7.69531250000000000000e-01, -9.38948592195160716646e-05,
+	9.06890595608501826064e-01,  1.67032603285508016895e-14,
+	7.67578125000000000000e-01,  2.59568279780940283207e-04,
+	9.09893083769929944538e-01,  1.11997717036818590290e-13,
+	7.66601562500000000000e-01, -3.56893480135617678899e-04,
+	9.12889336229909531539e-01,  5.20874444269056045356e-14,
+	7.64648437500000000000e-01,  9.80363369489085681690e-06,
+	9.15879378835825264105e-01, -5.21029147854686322416e-14,
+	7.62695312500000000000e-01,  3.83056234658331177557e-04,
+	9.18863237274536004406e-01,  5.85079923260685648937e-14,
+	7.61718750000000000000e-01, -2.13738726650242709263e-04,
+	9.21840937074421162833e-01,  6.88648630786830547119e-14,
+	7.59765625000000000000e-01,  1.72503534104181656611e-04,
+	9.24812503605835445342e-01, -5.45380729594021382940e-14,
+	7.58789062500000000000e-01, -4.11381868429913156223e-04,
+	9.27777962082245721831e-01,  9.64401083692489111642e-14,
+	7.56835937500000000000e-01, -1.23094926749338444530e-05,
+	9.30737337562959510251e-01, -7.32337787461465190072e-14,
+	7.54882812500000000000e-01,  3.93118926532990331166e-04,
+	9.33690654952215481899e-01,  1.82521187725311957857e-14,
+	7.53906250000000000000e-01, -1.71698025357893297458e-04,
+	9.36637939002594066551e-01, -2.35037966971124019086e-14,
+	7.51953125000000000000e-01,  2.46326054123487321081e-04,
+	9.39579214314790078788e-01, -9.70153107049742679109e-14,
+	7.50976562500000000000e-01, -3.05972118750747412112e-04,
+	9.42514505339204333723e-01,  3.55408971188513256901e-14,
+	7.49023437500000000000e-01,  1.24494482910004632039e-04,
+	9.45443836377990010078e-01, -7.84811042257618941321e-14,
+	7.48046875000000000000e-01, -4.15436806529084442542e-04,
+	9.48367231584597902838e-01,  7.97513521913510715183e-14,
+	7.46093750000000000000e-01,  2.73216516659238071389e-05,
+	9.51284714966959654703e-01,  1.23122743553814489519e-14,
+	7.44140625000000000000e-01,  4.76170297529500592421e-04,
+	9.54196310386805635062e-01,  6.95737440772501271481e-14,
+	7.43164062500000000000e-01, -4.54901306345426863936e-05,
+	9.57102041562393424101e-01, -1.07255252457768863064e-13,
+	7.41210937500000000000e-01,  4.15428900752273680234e-04,
+	9.60001932068053065450e-01,  2.78723634358038872657e-14,
+	7.40234375000000000000e-01, -9.42337824155665710474e-05,
+	9.62896005337370297639e-01, -1.09763300169716308024e-13,
+	7.38281250000000000000e-01,  3.78610935149264592886e-04,
+	9.65784284662049685721e-01,  3.73578896726472729937e-14,
+	7.37304687500000000000e-01, -1.19197544761213004415e-04,
+	9.68666793195097852731e-01,  1.10553193935628898621e-13,
+	7.35351562500000000000e-01,  3.65430463296080240698e-04,
+	9.71543553950823479681e-01, -5.14887042973928461315e-14,
+	7.34375000000000000000e-01, -1.20665074404309574630e-04,
+	9.74414589805519426591e-01,  7.66520463741940163421e-15,
+	7.32421875000000000000e-01,  3.75606086457603725783e-04,
+	9.77279923499963842914e-01, -4.73725649925326709461e-14,
+	7.31445312500000000000e-01, -9.89155345056786473390e-05,
+	9.80139577639192793868e-01, -3.57088255722473275455e-14,
+	7.29492187500000000000e-01,  4.08860854890577638671e-04,
+	9.82993574694319249829e-01, -9.12133576610531403310e-15,
+	7.28515625000000000000e-01, -5.42236832847489436680e-05,
+	9.85841937003442581045e-01, -1.02078797145754447812e-13,
+	7.26562500000000000000e-01,  4.64922180265024199194e-04,
+	9.88684686772103304975e-01,  6.25483052691091233845e-14,
+	7.25585937500000000000e-01,  1.31400394393561570247e-05,
+	9.91521846075784196728e-01, -8.89012464985742110005e-14,
+	7.24609375000000000000e-01, -4.33040749853662169152e-04,
+	9.94353436858773420681e-01,  8.45168968787592347678e-14,
+	7.22656250000000000000e-01,  1.02909427739006432479e-04,
+	9.97179480937575135613e-01,  4.62016931261633948895e-14,
+};
+
+static const double C[] = {
+	-3.46573590279972643113e-01,
+	1.60151004638970445582e-01,
+	-8.32561629967891320137e-02,
+	4.61671948311336080573e-02,
+	-2.66672484143244750698e-02,
+	4503599627370496.0,
+	0.0
+};
+
+#define	P2	C[0]
+#define	P3	C[1]
+#define	P4	C[2]
+#define	P5	C[3]
+#define	P6	C[4]
+#define	two52	C[5]
+#define	zero	C[6]
+
+#define	PROCESS(N)							\
+	i##N = (i##N + 0x800) & ~0xfff;					\
+	e = (i##N & 0x7ff00000) - 0x3ff00000;				\
+	z##N##.i[HIWORD] -= e;						\
+	w##N##.i[HIWORD] = i##N - e;					\
+	w##N##.i[LOWORD] = 0;						\
+	n##N += (e >> 20);						\
+	i##N = (i##N >> 10) & 0x3fc;					\
+	d##N = z##N##.d - w##N##.d;					\
+	h##N = d##N * TBL[i##N];					\
+	l##N = d##N * TBL[i##N+1];					\
+	s##N = h##N + l##N;						\
+	b##N = (s##N * s##N) * (P2 + s##N * (P3 + s##N * (P4 +		\
+	    s##N * (P5 + s##N * P6))));					\
+	*y = (n##N + TBL[i##N+2]) + (h##N + (l##N + TBL[i##N+3] +	\
+	    b##N));							\
+	y += stridey
+
+#define	PREPROCESS(N, index, label)					\
+	i##N = HI(*x);							\
+	z##N##.d = *x;							\
+	x += stridex;							\
+	n##N = 0;							\
+	if ((i##N & 0x7ff00000) == 0x7ff00000) { /* inf or NaN */	\
+		y[index] = z##N##.d * ((i##N < 0)? zero : z##N##.d);	\
+		goto label;						\
+	} else if (i##N < 0x00100000) { /* subnormal, negative, zero */	\
+		if (((i##N << 1) | z##N##.i[LOWORD]) == 0) {		\
+			y[index] = P2 / zero;				\
+			goto label;					\
+		} else if (i##N < 0) {					\
+			y[index] = zero / zero;				\
+			goto label;					\
+		}							\
+		z##N##.d *= two52;					\
+		n##N = -52;						\
+		i##N = z##N##.i[HIWORD];				\
+	}
+
+void
+__vlog2(int n, double *restrict x, int stridex, double *restrict y,
+	int stridey)
+{
+	union {
+		unsigned	i[2];
+		double		d;
+	} z0, z1, z2, z3, w0, w1, w2, w3;
+	double	b0, b1, b2, b3;
+	double	d0, d1, d2, d3;
+	double	h0, h1, h2, h3;
+	double	l0, l1, l2, l3;
+	double	s0, s1, s2, s3;
+	int	i0, i1, i2, i3, e;
+	int	n0, n1, n2, n3;
+
+	w0.i[LOWORD] = 0;
+	w1.i[LOWORD] = 0;
+	w2.i[LOWORD] = 0;
+	w3.i[LOWORD] = 0;
+
+	y -= stridey;
+
+	for (;;) {
+begin:
+		y += stridey;
+
+		if (--n < 0)
+			break;
+
+		PREPROCESS(0, 0, begin);
+
+		if (--n < 0)
+			goto process1;
+
+		PREPROCESS(1, stridey, process1);
+
+		if (--n < 0)
+			goto process2;
+
+		PREPROCESS(2, (stridey << 1), process2);
+
+		if (--n < 0)
+			goto process3;
+
+		PREPROCESS(3, (stridey << 1) + stridey, process3);
+
+		i0 = (i0 + 0x800) & ~0xfff;
+		e = (i0 & 0x7ff00000) - 0x3ff00000;
+		z0.i[HIWORD] -= e;
+		w0.i[HIWORD] = i0 - e;
+		n0 += (e >> 20);
+		i0 = (i0 >> 10) & 0x3fc;
+
+		i1 = (i1 + 0x800) & ~0xfff;
+		e = (i1 & 0x7ff00000) - 0x3ff00000;
+		z1.i[HIWORD] -= e;
+		w1.i[HIWORD] = i1 - e;
+		n1 += (e >> 20);
+		i1 = (i1 >> 10) & 0x3fc;
+
+		i2 = (i2 + 0x800) & ~0xfff;
+		e = (i2 & 0x7ff00000) - 0x3ff00000;
+		z2.i[HIWORD] -= e;
+		w2.i[HIWORD] = i2 - e;
+		n2 += (e >> 20);
+		i2 = (i2 >> 10) & 0x3fc;
+
+		i3 = (i3 + 0x800) & ~0xfff;
+		e = (i3 & 0x7ff00000) - 0x3ff00000;
+		z3.i[HIWORD] -= e;
+		w3.i[HIWORD] = i3 - e;
+		n3 += (e >> 20);
+		i3 = (i3 >> 10) & 0x3fc;
+
+		d0 = z0.d - w0.d;
+		d1 = z1.d - w1.d;
+		d2 = z2.d - w2.d;
+		d3 = z3.d - w3.d;
+
+		h0 = d0 * TBL[i0];
+		h1 = d1 * TBL[i1];
+		h2 = d2 * TBL[i2];
+		h3 = d3 * TBL[i3];
+
+		l0 = d0 * TBL[i0+1];
+		l1 = d1 * TBL[i1+1];
+		l2 = d2 * TBL[i2+1];
+		l3 = d3 * TBL[i3+1];
+
+		s0 = h0 + l0;
+		s1 = h1 + l1;
+		s2 = h2 + l2;
+		s3 = h3 + l3;
+
+		b0 = (s0 * s0) * (P2 + s0 * (P3 + s0 * (P4 +
+		    s0 * (P5 + s0 * P6))));
+		b1 = (s1 * s1) * (P2 + s1 * (P3 + s1 * (P4 +
+		    s1 * (P5 + s1 * P6))));
+		b2 = (s2 * s2) * (P2 + s2 * (P3 + s2 * (P4 +
+		    s2 * (P5 + s2 * P6))));
+		b3 = (s3 * s3) * (P2 + s3 * (P3 + s3 * (P4 +
+		    s3 * (P5 + s3 * P6))));
+
+		*y = (n0 + TBL[i0+2]) + (h0 + (l0 + TBL[i0+3] + b0));
+		y += stridey;
+		*y = (n1 + TBL[i1+2]) + (h1 + (l1 + TBL[i1+3] + b1));
+		y += stridey;
+		*y = (n2 + TBL[i2+2]) + (h2 + (l2 + TBL[i2+3] + b2));
+		y += stridey;
+		*y = (n3 + TBL[i3+2]) + (h3 + (l3 + TBL[i3+3] + b3));
+		continue;
+
+process1:
+		PROCESS(0);
+		continue;
+
+process2:
+		PROCESS(0);
+		PROCESS(1);
+		continue;
+
+process3:
+		PROCESS(0);
+		PROCESS(1);
+		PROCESS(2);
+	}
+}
@@ -0,0 +1,213 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vnormcdf: double precision vector standard normal distribution
+ * function
+ *
+ * Algorithm:
+ *
+ * normcdf(x) = erfc(t)/2 with t = -x/sqrt(2), evaluated as in __verfc
+ * (see there for the selection of the interval by table lookup and
+ * the in line exponential), with the tables of add and mul halved.
+ *
+ * The rounding error of t would be magnified by about 2*t*t in erfc(t),
+ * so t is formed as tr+tl: x is split as xh+xl with xh the high 21
+ * bits of x, and sqrt(1/2) as ch+cl with ch of 21 bits, so that xh*ch
+ * and xl*ch are exact.  The exponential uses -t*t = -x*x/2 directly,
+ * split as in erf.c with s = xh, and tl enters the polynomial argument
+ * of the interval [0.84375, 1.25), the linear term of the first
+ * interval and the division by |t| on the last two.
+ *
+ * |x| > 39.5 is treated as 39.5, whose normcdf rounds to 0 or 1.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 3 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern const double __vlibm_TBL_erf[];
+
+static const double C[] = {
+	1.0,
+	0.5,
+	5.625e-01,
+	4.61662413084468283841e+01,	/* 32/ln2 */
+	2.16608493865351192653e-02,	/* ln2/32 hi 3F962E42, FEE00000 */
+	5.96317165397058656257e-12,	/* ln2/32 lo */
+	6755399441055744.0,		/* 3*2^51 */
+	1.66666666666666666667e-01,	/* 1/3! */
+	4.16666666666666666667e-02,	/* 1/4! */
+	8.33333333333333333333e-03,	/* 1/5! */
+	1.38888888888888888889e-03,	/* 1/6! */
+	7.07106590270996093750e-01,	/* sqrt(1/2) hi 3FE6A09E, 00000000 */
+	1.90915551430650846399e-07,	/* sqrt(1/2) lo */
+};
+
+#define	one	C[0]
+#define	half	C[1]
+#define	c0_5625	C[2]
+#define	invln2_32	C[3]
+#define	ln2_32hi	C[4]
+#define	ln2_32lo	C[5]
+#define	magic	C[6]
+#define	E3	C[7]
+#define	E4	C[8]
+#define	E5	C[9]
+#define	E6	C[10]
+#define	ch	C[11]
+#define	cl	C[12]
+
+/*
+ * i = (k << 2) | (sign(t) << 1) | (|t| >= 1/4)
+ */
+static const double add[] = {
+	0.5, 0.25, 0.5, 0.5,
+	7.74685442447662353516e-02, 7.74685442447662353516e-02, /* (1-erx)/2 */
+	9.22531455755233764648e-01, 9.22531455755233764648e-01, /* (1+erx)/2 */
+	0.0, 0.0, 1.0, 1.0,
+	0.0, 0.0, 1.0, 1.0,
+};
+
+static const double sgn[] = {
+	1.0, -1.0,
+};
+
+static const double mul[] = {
+	-0.5, -0.5, -0.5, -0.5,
+	-0.5, -0.5, 0.5, 0.5,
+	0.5, 0.5, -0.5, -0.5,
+	0.5, 0.5, -0.5, -0.5,
+};
+
+static const double sub[] = {
+	0.0, 0.5, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0,
+};
+
+void
+__vnormcdf(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*c, *u;
+	double		xx, xh, xl, ax, tr, tl, atr, atl, z, v, p, q, h, l;
+	double		w, e, r, sc0, sc1;
+	int		hx, ix, ht, it, i, j, k, m;
+
+	LO(&sc0) = 0;
+	LO(&sc1) = 0;
+	for (; n > 0; n--, x += stridex, y += stridey) {
+		xx = *x;
+		hx = HI(&xx);
+		ix = hx & 0x7fffffff;
+		if (ix >= 0x4043c000) { /* |x| >= 39.5, inf or nan */
+			if (ix >= 0x7ff00000) {
+				*y = (double)(1 - (int)((unsigned)hx >> 31)) +
+				    one / xx;
+				continue;
+			}
+			HI(&xx) = (hx & 0x80000000) | 0x4043c000;
+			LO(&xx) = 0;
+			ix = 0x4043c000;
+		}
+
+		/* t = tr+tl = -x*sqrt(1/2) */
+		xh = xx;
+		LO(&xh) = 0;
+		xl = xx - xh;
+		p = xh * ch;
+		q = xl * ch + xx * cl;
+		tr = p + q;
+		tl = (p - tr) + q;
+		tr = -tr;
+		tl = -tl;
+		ht = HI(&tr);
+		it = ht & 0x7fffffff;
+		atr = sgn[(unsigned)ht >> 31] * tr;
+		atl = sgn[(unsigned)ht >> 31] * tl;
+
+		k = (it >= 0x3feb0000) + (it >= 0x3ff40000) +
+		    (it >= 0x4006db6e);
+		i = (k << 2) | (((unsigned)ht >> 31) << 1) |
+		    (it >= 0x3fd00000);
+		c = __vlibm_TBL_erf + (k << 4);
+		u = __vlibm_TBL_erf + 64 + (k << 3);
+
+		/* p/q of erf.c at u = t*t, |t|-1 or 1/(t*t) */
+		z = half * (xx * xx);
+		v = (u[0] * z + ((u[1] * atr + u[2]) + u[1] * atl)) /
+		    (u[3] * z + u[4]);
+		p = c[0] + v * (c[1] + v * (c[2] + v * (c[3] + v * (c[4] +
+		    v * (c[5] + v * (c[6] + v * c[7]))))));
+		q = one + v * (c[8] + v * (c[9] + v * (c[10] + v * (c[11] +
+		    v * (c[12] + v * (c[13] + v * (c[14] + v * c[15])))))));
+		p = p / q;
+
+		/* r = exp(-t*t-0.5625+p/q)/|t| where u[5] = 1 */
+		ax = xx;
+		HI(&ax) = ix;
+		xh = ax;
+		LO(&xh) = 0;
+		h = u[5] * (-(half * (xh * xh)) - c0_5625);
+		l = u[5] * (half * ((xh - ax) * (xh + ax)) + p);
+		w = (h + l) * invln2_32 + magic;
+		j = LO(&w);
+		w -= magic;
+		r = (h - w * ln2_32hi) + (l - w * ln2_32lo);
+		m = j >> 5;
+		j = (j & 31) << 1;
+		e = r * r * (half + r * (E3 + r * (E4 + r * (E5 +
+		    r * E6)))) + r;
+		e = __vlibm_TBL_erf[96+j] + (__vlibm_TBL_erf[97+j] +
+		    __vlibm_TBL_erf[96+j] * e);
+		HI(&sc0) = ((m >> 1) + 0x3ff) << 20;
+		HI(&sc1) = ((m - (m >> 1)) + 0x3ff) << 20;
+		r = ((e * sc0) / (atr + (one - u[5]))) * sc1;
+		r -= r * (atl * atr * v);
+		r = (one - u[5]) * p + u[5] * r;
+
+		*y = add[i] + mul[i] * ((u[6] * tr - sub[i]) + (u[6] * tl +
+		    (u[6] * tr + (one - u[6])) * r));
+	}
+}
@@ -0,0 +1,124 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vsincospif: single precision vector sincospi
+ *
+ * s[i] = sin(pi*x[i]), c[i] = cos(pi*x[i])
+ *
+ * Algorithm:
+ *
+ * As in __vsincospi, with the reduction of x exact and done in double,
+ * and sin(pi*r) and cos(pi*r) approximated by polynomials of degree 3
+ * in r^2 whose errors are below 2^-33; the result is rounded to float
+ * once.  Every |x| >= 2^23 is an integer, so r = 0 there.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.502 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern double fabs(double);
+
+static const double S[] = {
+	-5.16771277181535371170e+00,	/* C014ABBC, E5984619 */
+	2.55016278952927821777e+00,	/* 400466BB, BFA408F9 */
+	-5.99204968462119347272e-01,	/* BFE32CAF, E5E4A80D */
+	8.10213746095878595277e-02,	/* 3FB4BDD1, 1A39A314 */
+};
+
+static const double C[] = {
+	-4.93480216959590656245e+00,	/* C013BD3C, C7AA93BA */
+	4.05870755146817518977e+00,	/* 40103C1D, D5165611 */
+	-1.33504900041438401281e+00,	/* BFF55C5C, 57356575 */
+	2.31352232031078242080e-01,	/* 3FCD9CF3, 2F370D04 */
+};
+
+static const double K[] = {
+	0.0,
+	1.0,
+	0.5,
+	4503599627370496.0,		/* 2^52 */
+	3.14159265358979311600e+00,	/* pi 400921FB, 54442D18 */
+};
+
+#define	zero	K[0]
+#define	one	K[1]
+#define	half	K[2]
+#define	two52	K[3]
+#define	pi	K[4]
+
+/* signs of sin(pi*|x|) and cos(pi*|x|) by k mod 4 */
+static const double sgs[] = { 1.0, 1.0, -1.0, -1.0 };
+static const double sgc[] = { 1.0, -1.0, -1.0, 1.0 };
+
+void
+__vsincospif(int n, float *restrict x, int stridex, float *restrict s,
+    int strides, float *restrict c, int stridec)
+{
+	double		t, w, r, u, v[2];
+	int		i, hx, ix, k;
+
+	for (i = 0; i < n; i++, x += stridex, s += strides, c += stridec) {
+		hx = *(int *)x;
+		ix = hx & 0x7fffffff;
+		if (ix >= 0x4b000000) {	/* |x| >= 2^23, inf or nan */
+			if (ix >= 0x7f800000) {
+				*s = *c = *x - *x;
+				continue;
+			}
+			k = ((ix >> 23) == 0x96)? (ix & 1) << 1 : 0;
+			r = zero;
+		} else {
+			t = fabs((double)*x);
+			w = (t + t) + two52;
+			k = LO(&w) & 3;
+			r = t - half * (w - two52);
+		}
+		u = r * r;
+		v[0] = r * (pi + u * (S[0] + u * (S[1] + u * (S[2] + u * S[3]))));
+		v[1] = one + u * (C[0] + u * (C[1] + u * (C[2] + u * C[3])));
+		*s = (float)((sgs[k] * v[k & 1] + zero) * ((hx < 0)? -one : one));
+		*c = (float)(sgc[k] * v[(k & 1) ^ 1] + zero);
+	}
+}
@@ -0,0 +1,165 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vsinpi: double precision vector sinpi(x) = sin(pi*x)
+ *
+ * Algorithm:
+ *
+ * Since the argument is scaled by pi, the reduction is exact and needs
+ * no multiple precision value of pi: |x| = k/2 + r, |r| <= 1/4, with
+ * k = rint(2|x|) found by the two52 trick and r = |x| - k/2 computed
+ * exactly.  Every |x| >= 2^51 is a multiple of 1/2, so r = 0 and k mod
+ * 4 comes straight from the low bits of x.  Then
+ *
+ *	sin(pi*r) = p + r^3*S(r^2),
+ *	cos(pi*r) = 1 - p*p/2 + r^4*C(r^2),  p = pi*r,
+ *
+ * where S and C are polynomials of degree 6 and 5 on [0, 1/16] whose
+ * errors are below 2^-63.  p and p*p/2 are formed in extra precision:
+ * r and pi are split so that their heads have at most 13 bits, which
+ * makes both ph = rh*pi1 and ph*ph exact, and p = ph + pl.  The
+ * results for |x| follow from k mod 4 and the symmetries of sin and
+ * cos, and the sign of x is applied to sin.  Where two octants meet,
+ * at |r| = 1/4, sin(pi*r) is taken from the cos kernel, so that
+ * sinpi and cospi agree there exactly.
+ *
+ * sinpi(n) = +-0 with the sign of n and cospi(n+1/2) = +0 for integer
+ * n, as IEEE 754-2008 recommends; for NaN and +-Inf the results are
+ * NaN, with invalid raised for +-Inf.
+ *
+ * Accuracy:
+ *
+ * Maximum error observed: less than 0.74 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern double fabs(double);
+
+static const double S[] = {
+	-5.16771278004997025590e+00,	/* C014ABBC, E625BE53 */
+	2.55016403987739970205e+00,	/* 400466BC, 6775AB5C */
+	-5.99264529325425510109e-01,	/* BFE32D2C, CE63608C */
+	8.21458867975700807174e-02,	/* 3FB50783, 494BE639 */
+	-7.37043468066560670399e-03,	/* BF7E3075, FE927C35 */
+	4.66335720985548186912e-04,	/* 3F3E8FD0, ABABC110 */
+	-2.19493569604650854744e-05,	/* BEF703FC, 53342C2D */
+};
+
+static const double C[] = {
+	4.05871212641676049060e+00,	/* 40103C1F, 081B5ABB */
+	-1.33526276885298966768e+00,	/* BFF55D3C, 7E3CA3D5 */
+	2.35330630233906545890e-01,	/* 3FCE1F50, 684D046C */
+	-2.58068865610195305460e-02,	/* BF9A6D1E, D72A260E */
+	1.92947542559053540970e-03,	/* 3F5F9CCE, 767C7842 */
+	-1.03608593887040200754e-04,	/* BF1B290E, 16DD838A */
+};
+
+static const double K[] = {
+	0.0,
+	1.0,
+	0.5,
+	4503599627370496.0,		/* 2^52 */
+	3.14062500000000000000e+00,	/* pi, 13 bits 40092000, 00000000 */
+	9.67653589793238512809e-04,	/* pi - pi1    3F4FB544, 42D1846A */
+	0.0625,
+	1099511627777.0,		/* 2^40 + 1 */
+};
+
+#define	zero	K[0]
+#define	one	K[1]
+#define	half	K[2]
+#define	two52	K[3]
+#define	pi1	K[4]
+#define	pi2	K[5]
+#define	sixteenth	K[6]
+#define	split	K[7]
+
+/* sign of sin(pi*|x|) by k mod 4 */
+static const double sgs[] = { 1.0, 1.0, -1.0, -1.0 };
+
+void
+__vsinpi(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	double		t, w, r, rh, rl, u, ph, pl, qh, ql, u2, ps, pc, v[2];
+	int		i, hx, ix, k;
+
+	for (i = 0; i < n; i++, x += stridex, y += stridey) {
+		t = *x;
+		hx = HI(&t);
+		ix = hx & 0x7fffffff;
+		if (ix >= 0x43200000) {	/* |x| >= 2^51, inf or nan */
+			if (ix >= 0x7ff00000) {
+				*y = *x - *x;
+				continue;
+			}
+			k = (ix >> 20) - 0x432;
+			k = (k < 2)? (LO(&t) << k) & 3 : 0;
+			r = zero;
+		} else {
+			t = fabs(t);
+			w = (t + t) + two52;
+			k = LO(&w) & 3;
+			r = t - half * (w - two52);
+		}
+		w = r * split;
+		rh = w - (w - r);
+		rl = r - rh;
+		u = r * r;
+		ph = rh * pi1;
+		pl = rl * pi1 + r * pi2;
+		qh = half * (ph * ph);
+		ql = pl * (ph + half * pl);
+		w = one - qh;
+		u2 = u * u;
+		ps = S[0] + u * ((S[1] + u * S[2]) + u2 * (S[3] + u * S[4]) +
+		    (u2 * u2) * (S[5] + u * S[6]));
+		pc = C[0] + u * ((C[1] + u * C[2]) + u2 * (C[3] + u * C[4]) +
+		    (u2 * u2) * C[5]);
+		v[0] = ph + (pl + (u * r) * ps);
+		v[1] = w + ((((one - w) - qh) - ql) + u2 * pc);
+		if (u == sixteenth)	/* |r| = 1/4 */
+			v[0] = (r > zero)? v[1] : -v[1];
+		*y = (sgs[k] * v[k & 1] + zero) * ((hx < 0)? -one : one);
+	}
+}
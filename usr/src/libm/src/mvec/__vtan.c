@@ -0,0 +1,219 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+/*
+ * __vtan: double precision vector tan
+ *
+ * Each argument is reduced to r + rt with |r| <= pi/4 and a quadrant
+ * bit k, using the same three-step Cody-Waite reduction as __vsin for
+ * |x| <= 2^19*pi and __vlibm_rem_pio2i beyond that.  Since tan is odd
+ * and tan(r+pi/2) = -1/tan(r), we work with |r| and set the sign of
+ * the result at the end.
+ *
+ * For |r| < 0.15625 we use the rational approximation from __k_tan,
+ * forming -1/tan(r) with great care when k is odd.  Otherwise r is
+ * split as t + s with t a breakpoint of __vlibm_TBL_sincos_hi/lo and
+ * |s| < 2^-7, sin(r) and cos(r) are formed as head-tail pairs by the
+ * addition formulas, as __vsin does, and the quotient sin/cos or
+ * -cos/sin is computed to a little more than working precision.
+ *
+ * The largest error observed is less than 1 ulp.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define HI(x)	*(1+(int*)x)
+#define LO(x)	*(unsigned*)x
+#else
+#define HI(x)	*(int*)x
+#define LO(x)	*(1+(unsigned*)x)
+#endif
+
+#ifdef __RESTRICT
+#define restrict _Restrict
+#else
+#define restrict
+#endif
+
+extern const double __vlibm_TBL_sincos_hi[], __vlibm_TBL_sincos_lo[];
+extern int __vlibm_rem_pio2i( double, double * );
+
+static const double
+	half[2]	= { 0.5, -0.5 },
+	one_or_mone[2] = { 1.0, -1.0 },
+	one		= 1.0,
+	invpio2 = 0.636619772367581343075535,
+	pio2_1  = 1.570796326734125614166,
+	pio2_2  = 6.077100506303965976596e-11,
+	pio2_3  = 2.022266248711166455796e-21,
+	pio2_3t = 8.478427660368899643959e-32,
+	pp1		= -1.666666666605760465276263943134982554676e-0001,
+	pp2		=  8.333261209690963126718376566146180944442e-0003,
+	qq1		= -4.999999999977710986407023955908711557870e-0001,
+	qq2		=  4.166654863857219350645055881018842089580e-0002,
+	t1		=  3.71923358986516816929168705030406272271648049355e-0003,
+	t2		=  6.02645120354857866118436504621058702468872070312e+0000,
+	t3		=  2.42627327587398156083509093150496482849121093750e+0000,
+	t4		=  2.44968983934252770851003333518747240304946899414e+0000,
+	t5		=  6.07089252571767978849948121933266520500183105469e+0000,
+	t6		= -2.49403756995593761658369658107403665781021118164e+0000;
+
+void
+__vtan( int n, double * restrict x, int stridex, double * restrict y,
+	int stridey )
+{
+	double		ty[2], w_or_rw[2], x0, y0, fn, a, w, z, t, c, sgn;
+	double		nh, nl, dh, dl, q, qh, dhh;
+	unsigned	hx, xsb;
+	int			k, j;
+
+	for ( ; n--; x += stridex, y += stridey )
+	{
+		hx = HI(x);
+		xsb = hx & 0x80000000;
+		hx &= ~0x80000000;
+		x0 = *x;
+		if ( hx <= 0x3fe921fb )
+		{
+			if ( hx < 0x3e400000 )
+			{
+				volatile int v = *x;
+				*y = x0;
+				continue;
+			}
+			y0 = 0.0;
+			k = 0;
+		}
+		else if ( hx <= 0x413921fb )
+		{
+			k = (int) ( x0 * invpio2 + half[xsb>>31] );
+			fn = (double) k;
+			a = x0 - fn * pio2_1;
+			w = fn * pio2_2;
+			x0 = a - w;
+			y0 = ( a - x0 ) - w;
+			a = x0;
+			w = fn * pio2_3 - y0;
+			x0 = a - w;
+			y0 = ( a - x0 ) - w;
+			a = x0;
+			w = fn * pio2_3t - y0;
+			x0 = a - w;
+			y0 = ( a - x0 ) - w;
+			hx = HI(&x0);
+			xsb = hx & 0x80000000;
+			hx &= ~0x80000000;
+		}
+		else
+		{
+			if ( hx >= 0x7ff00000 )
+			{
+				*y = x0 - x0;
+				continue;
+			}
+			k = __vlibm_rem_pio2i( x0, ty );
+			if ( xsb )
+			{
+				/* tan(-x) = -tan(x) holds for either parity */
+				ty[0] = -ty[0];
+				ty[1] = -ty[1];
+			}
+			x0 = ty[0];
+			y0 = ty[1];
+			hx = HI(&x0);
+			xsb = hx & 0x80000000;
+			hx &= ~0x80000000;
+		}
+
+		/* now r = x0 + y0, work with |r| */
+		sgn = one_or_mone[xsb>>31];
+		x0 *= sgn;
+		y0 *= sgn;
+
+		if ( hx < 0x3fc40000 )
+		{
+			z = x0 * x0;
+			t = y0 + ( ( ( t1 * x0 ) * z ) * ( t2 + z * ( t3 + z ) ) ) *
+				( ( t4 + z ) * ( t5 + z * ( t6 + z ) ) );
+			w_or_rw[0] = w = x0 + t;
+
+			/*
+			 * -1/w = qh + q*((1+qh*wh)+qh*wl) with q = -1/w, qh
+			 * = q chopped, wh = w chopped and wl = (x0-wh)+t;
+			 * form it always rather than mispredict on k
+			 */
+			q = -one / w;
+			qh = q;
+			LO(&qh) = 0;
+			dhh = w;
+			LO(&dhh) = 0;
+			w_or_rw[1] = qh + q * ( ( one + qh * dhh ) + qh * ( ( x0 - dhh ) + t ) );
+			w = w_or_rw[k&1];
+		}
+		else
+		{
+			j = ( hx + 0x4000 ) & 0x7fff8000;
+			HI(&t) = j;
+			LO(&t) = 0;
+			x0 = ( x0 - t ) + y0;
+			z = x0 * x0;
+			c = z * ( qq1 + z * qq2 );
+			w = x0 * ( one + z * ( pp1 + z * pp2 ) );
+			j = ( ( j - 0x3fc40000 ) >> 13 ) & ~3;
+
+			/*
+			 * numerator sin or -cos, denominator cos or sin; each
+			 * entry's successor in the table is its derivative
+			 */
+			k = ( k & 1 ) * 3;
+			nh = __vlibm_TBL_sincos_hi[j+k];
+			nl = ( __vlibm_TBL_sincos_hi[j+((k+1)&3)] * w + nh * c ) +
+				__vlibm_TBL_sincos_lo[j+k];
+			k = ( k + 1 ) & 3;
+			dh = __vlibm_TBL_sincos_hi[j+k];
+			dl = ( __vlibm_TBL_sincos_hi[j+((k+1)&3)] * w + dh * c ) +
+				__vlibm_TBL_sincos_lo[j+k];
+
+			/*
+			 * Let d = dh+dl rounded, dt = (dh-d)+dl, q = 1/d and qh =
+			 * (nh+nl)*q chopped to 21 bits.  Then (nh+nl)/(d+dt) is
+			 * qh + q*((nh+nl)-qh*(d+dt)), and with dhh = d chopped,
+			 * nh-qh*dhh and qh*(d-dhh) are exact.
+			 */
+			c = dh + dl;
+			dl = ( dh - c ) + dl;
+			q = one / c;
+			qh = ( nh + nl ) * q;
+			LO(&qh) = 0;
+			dhh = c;
+			LO(&dhh) = 0;
+			w = qh + ( ( ( nh - qh * dhh ) - qh * ( c - dhh ) ) +
+				( nl - qh * dl ) ) * q;
+		}
+		*y = sgn * w;
+	}
+}
@@ -0,0 +1,65 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vtgammaf: single precision vector tgamma
+ *
+ * Each block of NBLK elements is widened to double, passed to
+ * __vtgamma and rounded back.  The double result is within 1 ulp, so
+ * the float result is correctly rounded but in rare cases, and results
+ * out of the float range overflow or underflow in the conversion.
+ */
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+extern void __vtgamma(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+void
+__vtgammaf(int n, float *restrict x, int stridex, float *restrict y,
+    int stridey)
+{
+	double		a[NBLK];
+	int		i, j, m;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = 0; i < m; i++, j += stridex)
+			a[i] = (double)x[j];
+		__vtgamma(m, a, 1, a, 1);
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = (float)a[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
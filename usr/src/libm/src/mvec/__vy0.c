@@ -0,0 +1,228 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vy0: double precision vector Bessel function y0
+ *
+ * Algorithm:
+ *
+ * As in j0.c: for 0 < x <= 8,
+ *
+ *	y0(x) = u(z)/v(z) + (2/pi)*j0(x)*log(x),  z = x*x,
+ *
+ * and for x > 8 the asymptotic form
+ *
+ *	y0(x) = (P(0,x)*ss + Q(0,x)*cc) / sqrt(pi*x),
+ *
+ * with cc and ss as in __vj0.  The small arguments of a block of NBLK
+ * elements are gathered into a buffer and their j0 and log taken with
+ * one call each to __vj0 and __vlog; the large ones are gathered into
+ * another and their sines and cosines taken with __vsincos and __vcos.
+ *
+ * y0(0) is -Inf with divide-by-zero raised and y0(x < 0) is NaN with
+ * invalid raised; unlike y0(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * The same as y0(): the error is small in absolute terms, but the
+ * relative error is large close to the zeros of y0.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern const double __vlibm_TBL_bessel[];
+extern void __vsincos(int, double *, int, double *, int, double *, int);
+extern void __vcos(int, double *, int, double *, int);
+extern void __vlog(int, double *, int, double *, int);
+extern void __vj0(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+/* y0(x) = u/v + (2/pi)*j0(x)*log(x), z = x*x, on (0, 8] */
+static const double u0[13] = {
+	-7.380429510868722526754723020704317641941e-0002,
+	1.772607102684869924301459663049874294814e-0001,
+	-1.524370666542713828604078090970799356306e-0002,
+	4.650819100693891757143771557629924591915e-0004,
+	-7.125768872339528975036316108718239946022e-0006,
+	6.411017001656104598327565004771515257146e-0008,
+	-3.694275157433032553021246812379258781665e-0010,
+	1.434364544206266624252820889648445263842e-0012,
+	-3.852064731859936455895036286874139896861e-0015,
+	7.182052899726138381739945881914874579696e-0018,
+	-9.060556574619677567323741194079797987200e-0021,
+	7.124435467408860515265552217131230511455e-0024,
+	-2.709726774636397615328813121715432044771e-0027,
+};
+
+static const double v0[5] = {
+	1.0,
+	4.678678931512549002587702477349214886475e-0003,
+	9.486828955529948534822800829497565178985e-0006,
+	1.001495929158861646659010844136682454906e-0008,
+	4.725338116256021660204443235685358593611e-0012,
+};
+
+static const double C[] = {
+	0.0,
+	1.0,
+	-1.0,
+	8.0,
+	-0.125,
+	1.0e10,
+	1.0e40,
+	8.9e307,
+	5.641895835477562869480794515607725858441e-0001, /* 1/sqrt(pi) */
+	0.636619772367581343075535053490057448,		 /* 2/pi */
+};
+
+#define	zero		C[0]
+#define	one		C[1]
+#define	mone		C[2]
+#define	eight		C[3]
+#define	meighth		C[4]
+#define	huge		C[5]
+#define	big		C[6]
+#define	ovfl2		C[7]
+#define	invsqrtpi	C[8]
+#define	tpi		C[9]
+
+void
+__vy0(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*T = __vlibm_TBL_bessel;
+	double		r[NBLK], xs[NBLK], x2[NBLK], sn[NBLK], cs[NBLK];
+	double		c2[NBLK], xa[NBLK], ja[NBLK], la[NBLK];
+	double		t, z, w, p, q, u, v, s, c, ss, cc;
+	int		id[NBLK], ia[NBLK];
+	int		i, j, k, ka, l, m, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = k = ka = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			if (ix > 0x7ff00000 || (ix == 0x7ff00000 &&
+			    LO(&t) != 0)) {	/* nan */
+				r[i] = t * t;
+			} else if ((ix | LO(&t)) == 0) {
+				r[i] = mone / zero;
+			} else if (hx < 0) {
+				r[i] = zero / zero;
+			} else if (ix == 0x7ff00000) {
+				r[i] = zero;
+			} else if (t > eight) {
+				xs[k] = t;
+				x2[k] = (t > ovfl2)? zero : t + t;
+				id[k++] = i;
+			} else {
+				xa[ka] = t;
+				ia[ka++] = i;
+			}
+		}
+		if (ka > 0) {
+			__vj0(ka, xa, 1, ja, 1);
+			__vlog(ka, xa, 1, la, 1);
+		}
+		for (i = 0; i < ka; i++) {
+			z = xa[i] * xa[i];
+			u = u0[12];
+			for (l = 11; l >= 0; l--)
+				u = u * z + u0[l];
+			v = v0[0] + z * (v0[1] + z * (v0[2] + z * (v0[3] +
+			    z * v0[4])));
+			r[ia[i]] = u / v + tpi * (ja[i] * la[i]);
+		}
+		if (k > 0) {
+			__vsincos(k, xs, 1, sn, 1, cs, 1);
+			__vcos(k, x2, 1, c2, 1);
+		}
+		for (i = 0; i < k; i++) {
+			t = xs[i];
+			s = sn[i];
+			c = cs[i];
+			if (t > ovfl2) {
+				ss = s - c;
+				cc = s + c;
+			} else if ((HI(&sn[i]) ^ HI(&cs[i])) < 0) {
+				ss = s - c;
+				cc = -c2[i] / ss;
+			} else {
+				cc = s + c;
+				ss = -c2[i] / cc;
+			}
+			if (t > big) {
+				r[id[i]] = (invsqrtpi * ss) / sqrt(t);
+				continue;
+			}
+			if (t > huge) {
+				u = one;
+				v = meighth / t;
+			} else {
+				w = eight / t;
+				z = w * w;
+				p = T[6];
+				q = T[14];
+				u = T[22];
+				v = T[30];
+				for (l = 5; l >= 0; l--) {
+					p = p * z + T[l];
+					q = q * z + T[8+l];
+					u = u * z + T[16+l];
+					v = v * z + T[24+l];
+				}
+				v = w * (u / v);
+				u = p / q;
+			}
+			r[id[i]] = invsqrtpi * (u * ss + v * cc) / sqrt(t);
+		}
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = r[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -0,0 +1,261 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+
+/*
+ * __vy1: double precision vector Bessel function y1
+ *
+ * Algorithm:
+ *
+ * As in j1.c: for 1e-20 < x <= 8,
+ *
+ *	y1(x) = x*u(z)/v(z) + (2/pi)*(j1(x)*log(x) - 1/x),  z = x*x,
+ *
+ * y1(x) = -(2/pi)/x below, and for x > 8 the asymptotic form
+ *
+ *	y1(x) = (P(1,x)*ss + Q(1,x)*cc) / sqrt(pi*x),
+ *
+ * with cc and ss as in __vj1.  As in __vy0, the j1 and log of the
+ * small arguments of a block are taken with __vj1 and __vlog, and the
+ * sines and cosines of the large ones with __vsincos and __vcos.
+ *
+ * y1(0) is -Inf with divide-by-zero raised and y1(x < 0) is NaN with
+ * invalid raised; unlike y1(), no error handler is called.
+ *
+ * Accuracy:
+ *
+ * The same as y1(): the error is small in absolute terms, but the
+ * relative error is large close to the zeros of y1.
+ */
+
+#include <sys/isa_defs.h>
+
+#ifdef _LITTLE_ENDIAN
+#define	HI(x)	*(1+(int *)x)
+#define	LO(x)	*(unsigned *)x
+#else
+#define	HI(x)	*(int *)x
+#define	LO(x)	*(1+(unsigned *)x)
+#endif
+
+#ifdef __RESTRICT
+#define	restrict _Restrict
+#else
+#define	restrict
+#endif
+
+#define	sqrt __sqrt
+
+extern double sqrt(double);
+extern const double __vlibm_TBL_bessel[];
+extern void __vsincos(int, double *, int, double *, int, double *, int);
+extern void __vcos(int, double *, int, double *, int);
+extern void __vlog(int, double *, int, double *, int);
+extern void __vj1(int, double *, int, double *, int);
+
+#define	NBLK	128
+
+/* y1(x) = x*u/v + (2/pi)*(j1(x)*log(x) - 1/x), z = x*x, on (0, 1.28) */
+static const double u0[4] = {
+	-1.960570906462389461018983259589655961560e-0001,
+	4.931824118350661953459180060007970291139e-0002,
+	-1.626975871565393656845930125424683008677e-0003,
+	1.359657517926394132692884168082224258360e-0005,
+};
+
+static const double v0[5] = {
+	1.0e0,
+	2.565807214838390835108224713630901653793e-0002,
+	3.374175208978404268650522752520906231508e-0004,
+	2.840368571306070719539936935220728843177e-0006,
+	1.396387402048998277638900944415752207592e-0008,
+};
+
+/* the same on [1.28, 8] */
+static const double u1[12] = {
+	-1.960570906462389473336339614647555351626e-0001,
+	5.336268030335074494231369159933012844735e-0002,
+	-2.684137504382748094149184541866332033280e-0003,
+	5.737671618979185736981543498580051903060e-0005,
+	-6.642696350686335339171171785557663224892e-0007,
+	4.692417922568160354012347591960362101664e-0009,
+	-2.161728635907789319335231338621412258355e-0011,
+	6.727353419738316107197644431844194668702e-0014,
+	-1.427502986803861372125234355906790573422e-0016,
+	2.020392498726806769468143219616642940371e-0019,
+	-1.761371948595104156753045457888272716340e-0022,
+	7.352828391941157905175042420249225115816e-0026,
+};
+
+static const double v1[5] = {
+	1.0e0,
+	5.029187436727947764916247076102283399442e-0003,
+	1.102693095808242775074856548927801750627e-0005,
+	1.268035774543174837829534603830227216291e-0008,
+	6.579416271766610825192542295821308730206e-0012,
+};
+
+static const double C[] = {
+	0.0,
+	1.0,
+	-1.0,
+	8.0,
+	0.375,
+	1.0e-20,
+	1.28,
+	1.0e10,
+	1.0e91,
+	8.9e307,
+	5.641895835477562869480794515607725858441e-0001, /* 1/sqrt(pi) */
+	0.636619772367581343075535053490057448,		 /* 2/pi */
+	-0.636619772367581343075535053490057448,
+};
+
+#define	zero		C[0]
+#define	one		C[1]
+#define	mone		C[2]
+#define	eight		C[3]
+#define	q3_8		C[4]
+#define	tiny		C[5]
+#define	r1_28		C[6]
+#define	huge		C[7]
+#define	big		C[8]
+#define	ovfl2		C[9]
+#define	invsqrtpi	C[10]
+#define	tpi		C[11]
+#define	mtpi		C[12]
+
+void
+__vy1(int n, double *restrict x, int stridex, double *restrict y,
+    int stridey)
+{
+	const double	*T = __vlibm_TBL_bessel + 32;
+	double		r[NBLK], xs[NBLK], x2[NBLK], sn[NBLK], cs[NBLK];
+	double		c2[NBLK], xa[NBLK], ja[NBLK], la[NBLK];
+	double		t, z, w, p, q, u, v, s, c, ss, cc;
+	int		id[NBLK], ia[NBLK];
+	int		i, j, k, ka, l, m, hx, ix;
+
+	while (n > 0) {
+		m = (n < NBLK)? n : NBLK;
+		for (i = j = k = ka = 0; i < m; i++, j += stridex) {
+			t = x[j];
+			hx = HI(&t);
+			ix = hx & 0x7fffffff;
+			if (ix > 0x7ff00000 || (ix == 0x7ff00000 &&
+			    LO(&t) != 0)) {	/* nan */
+				r[i] = t * t;
+			} else if ((ix | LO(&t)) == 0) {
+				r[i] = mone / zero;
+			} else if (hx < 0) {
+				r[i] = zero / zero;
+			} else if (ix == 0x7ff00000) {
+				r[i] = zero;
+			} else if (t > eight) {
+				xs[k] = t;
+				x2[k] = (t > ovfl2)? zero : t + t;
+				id[k++] = i;
+			} else if (t <= tiny) {
+				r[i] = mtpi / t;
+			} else {
+				xa[ka] = t;
+				ia[ka++] = i;
+			}
+		}
+		if (ka > 0) {
+			__vj1(ka, xa, 1, ja, 1);
+			__vlog(ka, xa, 1, la, 1);
+		}
+		for (i = 0; i < ka; i++) {
+			t = xa[i];
+			z = t * t;
+			if (t < r1_28) {
+				u = u0[3];
+				v = v0[3] + z * v0[4];
+				for (l = 2; l >= 0; l--) {
+					u = u * z + u0[l];
+					v = v * z + v0[l];
+				}
+			} else {
+				u = u1[11];
+				for (l = 10; l >= 0; l--)
+					u = u * z + u1[l];
+				v = v1[0] + z * (v1[1] + z * (v1[2] + z *
+				    (v1[3] + z * v1[4])));
+			}
+			r[ia[i]] = t * (u / v) + tpi * (ja[i] * la[i] - one /
+			    t);
+		}
+		if (k > 0) {
+			__vsincos(k, xs, 1, sn, 1, cs, 1);
+			__vcos(k, x2, 1, c2, 1);
+		}
+		for (i = 0; i < k; i++) {
+			t = xs[i];
+			s = sn[i];
+			c = cs[i];
+			if (t > ovfl2) {
+				ss = -s - c;
+				cc = s - c;
+			} else if ((HI(&sn[i]) ^ HI(&cs[i])) < 0) {
+				cc = s - c;
+				ss = c2[i] / cc;
+			} else {
+				ss = -s - c;
+				cc = c2[i] / ss;
+			}
+			if (t > big) {
+				r[id[i]] = (invsqrtpi * ss) / sqrt(t);
+				continue;
+			}
+			if (t > huge) {
+				u = one;
+				v = q3_8 / t;
+			} else {
+				w = eight / t;
+				z = w * w;
+				p = T[6];
+				q = T[14];
+				u = T[22];
+				v = T[30];
+				for (l = 5; l >= 0; l--) {
+					p = p * z + T[l];
+					q = q * z + T[8+l];
+					u = u * z + T[16+l];
+					v = v * z + T[24+l];
+				}
+				v = w * (u / v);
+				u = p / q;
+			}
+			r[id[i]] = invsqrtpi * (u * ss + v * cc) / sqrt(t);
+		}
+		for (i = j = 0; i < m; i++, j += stridey)
+			y[j] = r[i];
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
+}
@@ -35,19 +35,42 @@
 extern void __vexp( int, double *, int, double *, int );
 extern void __vsincos( int, double *, int, double *, int, double *, int );
 
+/*
+ * Compute a block of exp(Re x) and sincos(Im x) into buffers small
+ * enough to stay in cache and form y from them, so that x is read
+ * and y written once and no scratch array is needed
+ */
+#define	NBLK	128
+
 void
-__vz_exp( int n, double * restrict x, int stridex, double * restrict y,
-	int stridey, double * restrict tmp )
+__vz_exp_fused( int n, double * restrict x, int stridex, double * restrict y,
+	int stridey )
 {
-	int		i, j, k;
+	double	e[NBLK], s[NBLK], c[NBLK];
+	int		i, j, m;
 
 	stridex <<= 1;
 	stridey <<= 1;
-	__vexp( n, x, stridex, tmp, 1 );
-	__vsincos( n, x + 1, stridex, y + 1, stridey, y, stridey );
-	for ( i = j = 0; i < n; i++, j += stridey )
+	while ( n > 0 )
 	{
-		y[j] *= tmp[i];
-		y[j+1] *= tmp[i];
+		m = ( n < NBLK )? n : NBLK;
+		__vexp( m, x, stridex, e, 1 );
+		__vsincos( m, x + 1, stridex, s, 1, c, 1 );
+		for ( i = j = 0; i < m; i++, j += stridey )
+		{
+			y[j] = c[i] * e[i];
+			y[j+1] = s[i] * e[i];
+		}
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
 	}
 }
+
+/* ARGSUSED */
+void
+__vz_exp( int n, double * restrict x, int stridex, double * restrict y,
+	int stridey, double * restrict tmp )
+{
+	__vz_exp_fused( n, x, stridex, y, stridey );
+}
@@ -36,13 +36,31 @@ extern void __vatan2( int, double *, int, double *, int, double *, int );
 extern void __vhypot( int, double *, int, double *, int, double *, int );
 extern void __vlog( int, double *, int, double *, int );
 
+/*
+ * Work through the arrays in blocks small enough that the moduli and
+ * the block of x stay in cache between the three kernels, so each
+ * element of x and y moves through memory once; the results are
+ * identical to those of whole-array calls.
+ */
+#define	NBLK	128
+
 void
 __vz_log( int n, double * restrict x, int stridex, double * restrict y,
 	int stridey )
 {
+	double	r[NBLK];
+	int		m;
+
 	stridex <<= 1;
 	stridey <<= 1;
-	__vhypot( n, x, stridex, x + 1, stridex, y + 1, stridey );
-	__vlog( n, y + 1, stridey, y, stridey );
-	__vatan2( n, x + 1, stridex, x, stridex, y + 1, stridey );
+	while ( n > 0 )
+	{
+		m = ( n < NBLK )? n : NBLK;
+		__vhypot( m, x, stridex, x + 1, stridex, r, 1 );
+		__vlog( m, r, 1, y, stridey );
+		__vatan2( m, x + 1, stridex, x, stridex, y + 1, stridey );
+		x += m * stridex;
+		y += m * stridey;
+		n -= m;
+	}
 }
@@ -0,0 +1,57 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+extern void __vacosf( int, float *, int, float *, int );
+
+#pragma weak vacosf_ = __vacosf_
+
+#ifndef LIBMVEC_MT
+
+/* just invoke the serial function */
+void
+__vacosf_( int *n, float *x, int *stridex, float *y, int *stridey )
+{
+	__vacosf( *n, x, *stridex, y, *stridey );
+}
+
+#else
+
+#include "vlibm_mt.h"
+
+void
+__vacosf_( int *n, float *x, int *stridex, float *y, int *stridey )
+{
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vacosf;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( float ) );
+	__vlibm_mt( &d );
+}
+
+#endif
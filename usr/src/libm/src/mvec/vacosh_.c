@@ -0,0 +1,57 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+extern void __vacosh( int, double *, int, double *, int );
+
+#pragma weak vacosh_ = __vacosh_
+
+#ifndef LIBMVEC_MT
+
+/* just invoke the serial function */
+void
+__vacosh_( int *n, double *x, int *stridex, double *y, int *stridey )
+{
+	__vacosh( *n, x, *stridex, y, *stridey );
+}
+
+#else
+
+#include "vlibm_mt.h"
+
+void
+__vacosh_( int *n, double *x, int *stridex, double *y, int *stridey )
+{
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vacosh;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( double ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( double ) );
+	__vlibm_mt( &d );
+}
+
+#endif
@@ -30,7 +30,7 @@ extern void __vatan2f( int, float *, int, float *, int, float *, int );
 
 #pragma weak vatan2f_ = __vatan2f_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -42,50 +42,21 @@ __vatan2f_( int *n, float *y, int *stridey, float *x, int *stridex,
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *yp, *zp;
-static int sx, sy, sz;
-
-/* m-function for parallel vatan2f */
-void
-__vatan2f_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vatan2f( UpperBound - LowerBound + 1, yp + sy * LowerBound, sy,
-		xp + sx * LowerBound, sx, zp + sz * LowerBound, sz );
-}
+#include "vlibm_mt.h"
 
 void
 __vatan2f_( int *n, float *y, int *stridey, float *x, int *stridex,
 	float *z, int *stridez )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vatan2f( *n, y, *stridey, x, *stridex, z, *stridez );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-	zp = z;
-	sz = *stridez;
-
-	m.MFunctionPtr = &__vatan2f_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vatan2f;
+	d.kind = VLIBM_MT_B;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, y, *stridey, sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, x, *stridex, sizeof( float ) );
+	VLIBM_MT_ARG( d, 2, z, *stridez, sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
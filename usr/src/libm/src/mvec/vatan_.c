@@ -30,7 +30,7 @@ extern void __vatan( int, double *, int, double *, int );
 
 #pragma weak vatan_ = __vatan_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -41,47 +41,19 @@ __vatan_( int *n, double *x, int *stridex, double *y, int *stridey )
 
 #else
 
-#include "mtsk.h"
-
-static double *xp, *yp;
-static int sx, sy;
-
-/* m-function for parallel vatan */
-void
-__vatan_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vatan( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		yp + sy * LowerBound, sy );
-}
+#include "vlibm_mt.h"
 
 void
 __vatan_( int *n, double *x, int *stridex, double *y, int *stridey )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vatan( *n, x, *stridex, y, *stridey );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-
-	m.MFunctionPtr = &__vatan_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vatan;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( double ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( double ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -30,7 +30,7 @@ extern void __vc_abs( int, float *, int, float *, int );
 
 #pragma weak vc_abs_ = __vc_abs_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -41,47 +41,19 @@ __vc_abs_( int *n, float *x, int *stridex, float *y, int *stridey )
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *yp;
-static int sx, sy;
-
-/* m-function for parallel vc_abs */
-void
-__vc_abs_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vc_abs( UpperBound - LowerBound + 1, xp + ( sx << 1) * LowerBound, sx,
-		yp + ( sy << 1 ) * LowerBound, sy );
-}
+#include "vlibm_mt.h"
 
 void
 __vc_abs_( int *n, float *x, int *stridex, float *y, int *stridey )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vc_abs( *n, x, *stridex, y, *stridey );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-
-	m.MFunctionPtr = &__vc_abs_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vc_abs;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, 2 * sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -30,7 +30,7 @@ extern void __vc_exp( int, float *, int, float *, int, float * );
 
 #pragma weak vc_exp_ = __vc_exp_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -42,49 +42,21 @@ __vc_exp_( int *n, float *x, int *stridex, float *y, int *stridey,
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *yp, *tp;
-static int sx, sy;
-
-/* m-function for parallel vc_exp */
-void
-__vc_exp_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vc_exp( UpperBound - LowerBound + 1, xp + ( sx << 1 ) * LowerBound, sx,
-		yp + ( sy << 1 ) * LowerBound, sy, tp + LowerBound );
-}
+#include "vlibm_mt.h"
 
 void
 __vc_exp_( int *n, float *x, int *stridex, float *y, int *stridey,
 	float *tmp )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vc_exp( *n, x, *stridex, y, *stridey, tmp );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-	tp = tmp;
-
-	m.MFunctionPtr = &__vc_exp_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vc_exp;
+	d.kind = VLIBM_MT_E;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, 2 * sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, 2 * sizeof( float ) );
+	VLIBM_MT_ARG( d, 2, tmp, 1, sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -31,7 +31,7 @@ extern void __vc_pow( int, float *, int, float *, int, float *, int,
 
 #pragma weak vc_pow_ = __vc_pow_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -43,52 +43,23 @@ __vc_pow_( int *n, float *x, int *stridex, float *y, int *stridey,
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *yp, *zp, *tp;
-static int sx, sy, sz;
-
-/* m-function for parallel vc_pow */
-void
-__vc_pow_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vc_pow( UpperBound - LowerBound + 1, xp + ( sx << 1 ) * LowerBound, sx,
-		yp + ( sy << 1 ) * LowerBound, sy, zp + ( sz << 1 ) * LowerBound, sz,
-		tp + LowerBound );
-}
+#include "vlibm_mt.h"
 
 void
 __vc_pow_( int *n, float *x, int *stridex, float *y, int *stridey,
 	float *z, int *stridez, float *tmp )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vc_pow( *n, x, *stridex, y, *stridey, z, *stridez, tmp );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-	zp = z;
-	sz = *stridez;
-	tp = tmp;
+	struct __vlibm_mt d;
 
-	m.MFunctionPtr = &__vc_pow_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	d.fn = (void (*)()) __vc_pow;
+	d.kind = VLIBM_MT_P;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, 2 * sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, 2 * sizeof( float ) );
+	VLIBM_MT_ARG( d, 2, z, *stridez, 2 * sizeof( float ) );
+	/* __vc_pow uses three floats of tmp per element */
+	VLIBM_MT_ARG( d, 3, tmp, 1, 3 * sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -48,7 +48,7 @@ extern void __vcos_ultra3( int, double *, int, double *, int );
 
 #pragma weak vcos_ = __vcos_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -76,36 +76,12 @@ __vcos_( int *n, double *x, int *stridex, double *y, int *stridey )
 
 #else
 
-#include "mtsk.h"
-
-static double *xp, *yp;
-static int sx, sy;
-
-/* m-function for parallel vcos */
-void
-__vcos_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vcos( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		yp + sy * LowerBound, sy );
-}
-
-#ifdef CHECK_ULTRA3
-/* m-function for ultra3 version of parallel vcos */
-void
-__vcos_ultra3_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vcos_ultra3( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		yp + sy * LowerBound, sy );
-}
-#endif
+#include "vlibm_mt.h"
 
 void
 __vcos_( int *n, double *x, int *stridex, double *y, int *stridey )
 {
-	struct MFunctionBlock m;
-	int i;
+	struct __vlibm_mt d;
 #ifdef CHECK_ULTRA3
 	int		u;
 	char	buf[BUFLEN];
@@ -119,39 +95,16 @@ __vcos_( int *n, double *x, int *stridex, double *y, int *stridey )
 			u = 1;
 		use_ultra3 = u;
 	}
-#endif
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-#ifdef CHECK_ULTRA3
-		if (u & 2)
-			__vcos_ultra3( *n, x, *stridex, y, *stridey );
-		else
-#endif
-		__vcos( *n, x, *stridex, y, *stridey );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-
-#ifdef CHECK_ULTRA3
 	if (u & 2)
-		m.MFunctionPtr = &__vcos_ultra3_mfunc;
+		d.fn = (void (*)()) __vcos_ultra3;
 	else
 #endif
-	m.MFunctionPtr = &__vcos_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	d.fn = (void (*)()) __vcos;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( double ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( double ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -0,0 +1,75 @@
+/*
+ * CDDL HEADER START
+ *
+ * The contents of this file are subject to the terms of the
+ * Common Development and Distribution License (the "License").
+ * You may not use this file except in compliance with the License.
+ *
+ * You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+ * or http://www.opensolaris.org/os/licensing.
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ *
+ * When distributing Covered Code, include this CDDL HEADER in each
+ * file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+ * If applicable, add the following below this CDDL HEADER, with the
+ * fields enclosed by brackets "[]" replaced with your own identifying
+ * information: Portions Copyright [yyyy] [name of copyright owner]
+ *
+ * CDDL HEADER END
+ */
+
+/*
+ * Copyright 2026 The libm contributors.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#ifndef	_VLIBM_MT_H
+#define	_VLIBM_MT_H
+
+#include <pthread.h>
+
+/*
+ * Work descriptor for running one call of a serial vector function
+ * on the libmvec thread pool.  The Fortran wrappers fill in the
+ * public part on their own stack and pass it to __vlibm_mt, which
+ * splits [0, n) into chunks and returns once every chunk is done;
+ * nothing about a call is kept in static storage, so any number of
+ * threads may use the pool at once.
+ */
+
+/* shapes of the serial function's argument list */
+#define	VLIBM_MT_U	0	/* (n, x, sx, y, sy) */
+#define	VLIBM_MT_B	1	/* (n, x, sx, y, sy, z, sz) */
+#define	VLIBM_MT_E	2	/* (n, x, sx, y, sy, tmp) */
+#define	VLIBM_MT_P	3	/* (n, x, sx, y, sy, z, sz, tmp) */
+
+#define	VLIBM_MT_MAXARG	4
+
+struct __vlibm_mt {
+	void		(*fn)();	/* serial function */
+	int		kind;		/* VLIBM_MT_U, _B, _E or _P */
+	int		n;		/* number of elements */
+	char		*a[VLIBM_MT_MAXARG];	/* array arguments */
+	int		s[VLIBM_MT_MAXARG];	/* their strides */
+	int		esz[VLIBM_MT_MAXARG];	/* bytes per unit stride */
+	/* private to __vlibm_mt.c */
+	struct __vlibm_mt *next;	/* link in the pool's queue */
+	pthread_cond_t	cv;		/* signalled when all chunks are done */
+	int		nchunk;		/* number of chunks */
+	int		claimed;	/* chunks handed out */
+	int		done;		/* chunks finished */
+	int		unit;		/* chunk bounds are multiples of unit */
+	int		first;		/* ... offset by first */
+};
+
+/*
+ * Set array argument i; a tmp array, which takes no stride argument,
+ * has a stride of 1 and sz set to the tmp space used per element
+ */
+#define	VLIBM_MT_ARG(d, i, p, st, sz) \
+	((d).a[i] = (char *)(p), (d).s[i] = (st), (d).esz[i] = (sz))
+
+extern void __vlibm_mt(struct __vlibm_mt *);
+
+#endif	/* _VLIBM_MT_H */
@@ -30,7 +30,7 @@ extern void __vsincos( int, double *, int, double *, int, double *, int );
 
 #pragma weak vsincos_ = __vsincos_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -42,50 +42,21 @@ __vsincos_( int *n, double *x, int *stridex, double *s, int *strides,
 
 #else
 
-#include "mtsk.h"
-
-static double *xp, *sp, *cp;
-static int sx, ss, sc;
-
-/* m-function for parallel vsincos */
-void
-__vsincos_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vsincos( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		sp + ss * LowerBound, ss, cp + sc * LowerBound, sc );
-}
+#include "vlibm_mt.h"
 
 void
 __vsincos_( int *n, double *x, int *stridex, double *s, int *strides,
 	double *c, int *stridec )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vsincos( *n, x, *stridex, s, *strides, c, *stridec );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	sp = s;
-	ss = *strides;
-	cp = c;
-	sc = *stridec;
-
-	m.MFunctionPtr = &__vsincos_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vsincos;
+	d.kind = VLIBM_MT_B;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( double ) );
+	VLIBM_MT_ARG( d, 1, s, *strides, sizeof( double ) );
+	VLIBM_MT_ARG( d, 2, c, *stridec, sizeof( double ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -30,7 +30,7 @@ extern void __vsincosf( int, float *, int, float *, int, float *, int );
 
 #pragma weak vsincosf_ = __vsincosf_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -42,50 +42,21 @@ __vsincosf_( int *n, float *x, int *stridex, float *s, int *strides,
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *sp, *cp;
-static int sx, ss, sc;
-
-/* m-function for parallel vsincosf */
-void
-__vsincosf_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vsincosf( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		sp + ss * LowerBound, ss, cp + sc * LowerBound, sc );
-}
+#include "vlibm_mt.h"
 
 void
 __vsincosf_( int *n, float *x, int *stridex, float *s, int *strides,
 	float *c, int *stridec )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vsincosf( *n, x, *stridex, s, *strides, c, *stridec );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	sp = s;
-	ss = *strides;
-	cp = c;
-	sc = *stridec;
-
-	m.MFunctionPtr = &__vsincosf_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	struct __vlibm_mt d;
+
+	d.fn = (void (*)()) __vsincosf;
+	d.kind = VLIBM_MT_B;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, s, *strides, sizeof( float ) );
+	VLIBM_MT_ARG( d, 2, c, *stridec, sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
@@ -48,7 +48,7 @@ extern void __vsqrtf_ultra3( int, float *, int, float *, int );
 
 #pragma weak vsqrtf_ = __vsqrtf_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -76,36 +76,12 @@ __vsqrtf_( int *n, float *x, int *stridex, float *y, int *stridey )
 
 #else
 
-#include "mtsk.h"
-
-static float *xp, *yp;
-static int sx, sy;
-
-/* m-function for parallel vsqrtf */
-void
-__vsqrtf_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vsqrtf( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		yp + sy * LowerBound, sy );
-}
-
-#ifdef CHECK_ULTRA3
-/* m-function for ultra3 version of parallel vsqrtf */
-void
-__vsqrtf_ultra3_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vsqrtf_ultra3( UpperBound - LowerBound + 1, xp + sx * LowerBound, sx,
-		yp + sy * LowerBound, sy );
-}
-#endif
+#include "vlibm_mt.h"
 
 void
 __vsqrtf_( int *n, float *x, int *stridex, float *y, int *stridey )
 {
-	struct MFunctionBlock m;
-	int i;
+	struct __vlibm_mt d;
 #ifdef CHECK_ULTRA3
 	int		u;
 	char	buf[BUFLEN];
@@ -119,39 +95,16 @@ __vsqrtf_( int *n, float *x, int *stridex, float *y, int *stridey )
 			u = 1;
 		use_ultra3 = u;
 	}
-#endif
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-#ifdef CHECK_ULTRA3
-		if (u & 2)
-			__vsqrtf_ultra3( *n, x, *stridex, y, *stridey );
-		else
-#endif
-		__vsqrtf( *n, x, *stridex, y, *stridey );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-
-#ifdef CHECK_ULTRA3
 	if (u & 2)
-		m.MFunctionPtr = &__vsqrtf_ultra3_mfunc;
+		d.fn = (void (*)()) __vsqrtf_ultra3;
 	else
 #endif
-	m.MFunctionPtr = &__vsqrtf_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	d.fn = (void (*)()) __vsqrtf;
+	d.kind = VLIBM_MT_U;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, sizeof( float ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, sizeof( float ) );
+	__vlibm_mt( &d );
 }
 
 #endif
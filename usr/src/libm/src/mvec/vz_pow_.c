@@ -31,7 +31,7 @@ extern void __vz_pow( int, double *, int, double *, int, double *, int,
 
 #pragma weak vz_pow_ = __vz_pow_
 
-#ifndef LIBMTSK_BASED
+#ifndef LIBMVEC_MT
 
 /* just invoke the serial function */
 void
@@ -43,52 +43,23 @@ __vz_pow_( int *n, double *x, int *stridex, double *y, int *stridey,
 
 #else
 
-#include "mtsk.h"
-
-static double *xp, *yp, *zp, *tp;
-static int sx, sy, sz;
-
-/* m-function for parallel vz_pow */
-void
-__vz_pow_mfunc( struct MFunctionBlock *MFunctionBlockPtr, int LowerBound,
-	int UpperBound, int Step )
-{
-	__vz_pow( UpperBound - LowerBound + 1, xp + ( sx << 1 ) * LowerBound, sx,
-		yp + ( sy << 1 ) * LowerBound, sy, zp + ( sz << 1 ) * LowerBound, sz,
-		tp + LowerBound );
-}
+#include "vlibm_mt.h"
 
 void
 __vz_pow_( int *n, double *x, int *stridex, double *y, int *stridey,
 	double *z, int *stridez, double *tmp )
 {
-	struct MFunctionBlock m;
-	int i;
-
-	/* if ncpus < 2, we are already in a parallel construct, or there
-	   aren't enough vector elements to bother parallelizing, just
-	   invoke the serial function */
-	i = __mt_getncpus_();
-	if ( i < 2 || *n < ( i << 3 ) || __mt_inepc_() || __mt_inapc_() )
-	{
-		__vz_pow( *n, x, *stridex, y, *stridey, z, *stridez, tmp );
-		return;
-	}
-
-	/* should be safe, we already know we're not in a parallel region */
-	xp = x;
-	sx = *stridex;
-	yp = y;
-	sy = *stridey;
-	zp = z;
-	sz = *stridez;
-	tp = tmp;
+	struct __vlibm_mt d;
 
-	m.MFunctionPtr = &__vz_pow_mfunc;
-	m.LowerBound = 0;
-	m.UpperBound = *n - 1;
-	m.Step = 1;
-	__mt_dopar_vfun_( m.MFunctionPtr, m.LowerBound, m.UpperBound, m.Step );
+	d.fn = (void (*)()) __vz_pow;
+	d.kind = VLIBM_MT_P;
+	d.n = *n;
+	VLIBM_MT_ARG( d, 0, x, *stridex, 2 * sizeof( double ) );
+	VLIBM_MT_ARG( d, 1, y, *stridey, 2 * sizeof( double ) );
+	VLIBM_MT_ARG( d, 2, z, *stridez, 2 * sizeof( double ) );
+	/* __vz_pow uses three doubles of tmp per element */
+	VLIBM_MT_ARG( d, 3, tmp, 1, 3 * sizeof( double ) );
+	__vlibm_mt( &d );
 }
 
 #endif